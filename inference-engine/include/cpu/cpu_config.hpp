@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief Shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+/**
+ * @def CPU_CONFIG_VALUE(name)
+ * @brief Shortcut for defining configuration values
+ */
+#define CPU_CONFIG_VALUE(name) InferenceEngine::CPUConfigParams::CPU_##name
+
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key enables graph-wide selection of primitive descriptors which minimizes the amount of reorders.
+ *
+ * By default every node selects its layout greedily looking at its parents only.
+ * With this option turned on the plugin additionally refines the selected layouts using
+ * a cost model of primitive implementation priority and reorder traffic on both input and output edges.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(LAYOUT_OPTIMIZATION);
+
+/**
+ * @brief The key sets a directory of the file-backed store of prepacked weights.
+ *
+ * Prepacked weights are shared between streams of a network and between networks alive at the same time.
+ * With this option the plugin also spills them to the directory and maps them from there,
+ * so several processes on one host loading the same model keep a single copy in memory.
+ * The key is applied when a network is loaded, both from SetConfig() and from the LoadNetwork() config.
+ * Networks loaded with different directories don't share prepacked weights in memory.
+ * Empty string (default) disables the store.
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief The key enables auto-tuning of streams and threads configuration in LoadNetwork().
+ *
+ * The plugin loads the network with a number of candidate CPU_THROUGHPUT_STREAMS/CPU_THREADS_NUM settings,
+ * measures each of them and uses the best one for the returned executable network.
+ * This option should be used with values: CPUConfigParams::CPU_TUNE_THROUGHPUT, CPUConfigParams::CPU_TUNE_LATENCY
+ * or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(AUTO_TUNE);
+DECLARE_CPU_CONFIG_VALUE(TUNE_THROUGHPUT);
+DECLARE_CPU_CONFIG_VALUE(TUNE_LATENCY);
+
+/**
+ * @brief The key sets a latency limit in milliseconds for CPU_TUNE_THROUGHPUT auto-tuning.
+ *
+ * Only configurations with 90th percentile of latency within the limit are considered.
+ * Zero (default) means no limit.
+ */
+DECLARE_CPU_CONFIG_KEY(AUTO_TUNE_LATENCY_SLA);
+
+/**
+ * @brief The key sets time in milliseconds spent on measuring every candidate configuration (500 by default).
+ */
+DECLARE_CPU_CONFIG_KEY(AUTO_TUNE_TIME);
+
+/**
+ * @brief The key sets a path to a file where results of auto-tuning are persisted per model and machine.
+ *
+ * If the file already contains a result for the network, it is applied without measurements.
+ * Empty string (default) means results are not persisted.
+ */
+DECLARE_CPU_CONFIG_KEY(AUTO_TUNE_CACHE);
+
+/**
+ * @brief The key enables collection of hardware performance counters per primitive.
+ *
+ * Cycles, instructions and last level cache misses of all threads executing a primitive are collected
+ * with Linux perf_event_open. They are reported together with estimated GFLOPS and GB/s as runtime attributes
+ * of the executable graph, see ExecutableNetwork::GetExecGraphInfo(), which shows the first stream.
+ * The counters are not reported if the system doesn't allow to open them.
+ * Counters are per thread, so with several streams inferred in parallel the values of a primitive
+ * also include work done meanwhile by other streams on threads shared between them (e.g. TBB workers).
+ * Use a single stream for exact per-primitive values.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(HW_COUNTERS);
+
+/**
+ * @brief The key enables the low latency mode of the streams executor.
+ *
+ * Stream threads poll for new tasks for a while before they sleep, each infer request is pinned to one stream
+ * and the synchronous Infer() runs on the calling thread within the task arena of the request stream.
+ * It removes thread wake up costs from the latency of small networks at the price of CPU time spent on polling.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(LOW_LATENCY);
+
+}  // namespace CPUConfigParams
+}  // namespace InferenceEngine
@@ -342,6 +342,8 @@ extern template struct INFERENCE_ENGINE_API_CLASS(
     InferenceEngine::Parameter::RealData<std::tuple<unsigned int, unsigned int>>);
 extern template struct INFERENCE_ENGINE_API_CLASS(
     InferenceEngine::Parameter::RealData<std::tuple<unsigned int, unsigned int, unsigned int>>);
+extern template struct INFERENCE_ENGINE_API_CLASS(
+    InferenceEngine::Parameter::RealData<std::map<std::string, uint64_t>>);
 #endif  // __clang__
 
 }  // namespace InferenceEngine
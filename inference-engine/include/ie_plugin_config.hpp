@@ -12,6 +12,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -158,6 +160,14 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a std::map<std::string, uint64_t> of memory used by an executable network in bytes per category.
+ *
+ * String value is "MEMORY_USAGE". The map always contains the "total" key, other categories are device specific.
+ * When it is used as a device metric, memory of all executable networks loaded to the device is reported.
+ */
+DECLARE_METRIC_KEY(MEMORY_USAGE, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -347,9 +357,20 @@ DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
  * Should be passed into LoadNetwork method to enable dumping of internal graph of primitives and
  * corresponding configuration information. Value is a name of output dot file without extension.
  * Files `<dot_file_name>_init.dot` and `<dot_file_name>_perf.dot` will be produced.
+ * The CPU plugin also produces `<dot_file_name>_reorders.csv` with the list of inserted reorders and their average time.
  */
 DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
 
+/**
+ * @brief This key enables recording of the inference timeline.
+ *
+ * It is passed to Core::SetConfig(), value is a name of output Chrome trace JSON file which can be opened
+ * in chrome://tracing. Executor tasks, async request pipeline stages and profiled plugin sections of all
+ * devices are recorded. The file is written when the key is set again or at process exit.
+ * An empty value disables recording.
+ */
+DECLARE_CONFIG_KEY(PERF_TRACE_FILE);
+
 
 /**
  * @brief The name for setting to execute in bfloat16 precision whenever it is possible
@@ -48,6 +48,16 @@ static const char infer_num_streams_message[] = "Optional. Number of streams to
                                                 "usually provides a reasonable performance, it still may be non - optimal for some cases, especially for "
                                                 "very small networks. See sample's README for more details.";
 
+/// @brief message for auto-tuning of CPU streams and threads
+static const char tune_message[] = "Optional. Auto-tune number of streams and threads on the CPU for \"THROUGHPUT\" or \"LATENCY\" goal "
+                                   "while loading the network. Overrides -nstreams for the CPU.";
+
+/// @brief message for latency limit of auto-tuning
+static const char tune_sla_message[] = "Optional. Latency limit in milliseconds for the THROUGHPUT auto-tuning goal.";
+
+/// @brief message for auto-tuning results file
+static const char tune_cache_message[] = "Optional. Path to a file where auto-tuning results are stored and reused for the same model and machine.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] = "Optional. Enforcing of floating point operations execution in bfloat16 precision where it is acceptable.";
 
@@ -88,6 +98,11 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for hardware performance counters option
+static const char pc_hw_message[] = "Optional. Collect hardware performance counters per layer on the CPU (Linux only)."
+                                    " Cycles, instructions, LLC misses and estimated GFLOPS and GB/s are reported with -pc."
+                                    " With several streams the counters include work of other streams.";
+
 #ifdef USE_OPENCV
 // @brief message for load config option
 static const char load_config_message[] = "Optional. Path to XML/YAML/JSON file to load custom IE parameters."
@@ -148,6 +163,15 @@ DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
+/// @brief Auto-tuning goal for CPU streams and threads
+DEFINE_string(tune, "", tune_message);
+
+/// @brief Latency limit for auto-tuning
+DEFINE_double(tune_sla, 0.0, tune_sla_message);
+
+/// @brief File with auto-tuning results
+DEFINE_string(tune_cache, "", tune_cache_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -176,6 +200,9 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for collecting hardware performance counters <br>
+DEFINE_bool(pc_hw, false, pc_hw_message);
+
 #ifdef USE_OPENCV
 /// @brief Define flag for loading configuration file <br>
 DEFINE_string(load_config, "", load_config_message);
@@ -216,6 +243,9 @@ static void showUsage() {
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
+    std::cout << "    -tune \"<goal>\"            " << tune_message << std::endl;
+    std::cout << "    -tune_sla \"<float>\"       " << tune_sla_message << std::endl;
+    std::cout << "    -tune_cache \"<path>\"      " << tune_cache_message << std::endl;
     std::cout << "    -enforcebf16              " << enforce_bf16_message << std::endl;
     std::cout << "    -pin \"YES\"/\"NO\"/\"NUMA\"    " << infer_threads_pinning_message << std::endl;
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
@@ -223,6 +253,7 @@ static void showUsage() {
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -pc_hw                    " << pc_hw_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
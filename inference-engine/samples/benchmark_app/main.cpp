@@ -13,6 +13,7 @@
 #include <inference_engine.hpp>
 #include <vpu/vpu_plugin_config.hpp>
 #include <cldnn/cldnn_config.hpp>
+#include <cpu/cpu_config.hpp>
 #include <gna/gna_config.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
@@ -66,6 +67,10 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (!FLAGS_tune.empty() && FLAGS_tune != "THROUGHPUT" && FLAGS_tune != "LATENCY") {
+        throw std::logic_error("Incorrect auto-tuning goal. Please set -tune option to `THROUGHPUT` or `LATENCY` value.");
+    }
+
     return true;
 }
 
@@ -246,6 +251,9 @@ int main(int argc, char *argv[]) {
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
+                if (FLAGS_pc_hw)
+                    device_config[CPU_CONFIG_KEY(HW_COUNTERS)] = CONFIG_VALUE(YES);
+
                 if (isFlagSetInCommandLine("pin")) {
                     // set to user defined value
                     device_config[CONFIG_KEY(CPU_BIND_THREAD)] = FLAGS_pin;
@@ -261,8 +269,19 @@ int main(int argc, char *argv[]) {
                     }
                 }
 
-                // for CPU execution, more throughput-oriented execution via streams
-                setThroughputStreams();
+                if (!FLAGS_tune.empty()) {
+                    // streams and threads are selected by the plugin while loading the network
+                    device_config[CPU_CONFIG_KEY(AUTO_TUNE)] = FLAGS_tune == "LATENCY" ?
+                            CPU_CONFIG_VALUE(TUNE_LATENCY) : CPU_CONFIG_VALUE(TUNE_THROUGHPUT);
+                    if (isFlagSetInCommandLine("tune_sla"))
+                        device_config[CPU_CONFIG_KEY(AUTO_TUNE_LATENCY_SLA)] = std::to_string(FLAGS_tune_sla);
+                    if (!FLAGS_tune_cache.empty())
+                        device_config[CPU_CONFIG_KEY(AUTO_TUNE_CACHE)] = FLAGS_tune_cache;
+                    device_nstreams.erase(device);
+                } else {
+                    // for CPU execution, more throughput-oriented execution via streams
+                    setThroughputStreams();
+                }
             } else if (device == ("GPU")) {
                 // for GPU execution, more throughput-oriented execution via streams
                 setThroughputStreams();
@@ -401,6 +420,10 @@ int main(int argc, char *argv[]) {
             const std::string key = ds.first + "_THROUGHPUT_STREAMS";
             device_nstreams[ds.first] = ie.GetConfig(ds.first, key).as<std::string>();
         }
+        // Auto-tuned number of streams belongs to the loaded network rather than to the device
+        if (!FLAGS_tune.empty() && device_name == "CPU") {
+            device_nstreams["CPU"] = exeNetwork.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>();
+        }
 
         // Number of requests
         uint32_t nireq = FLAGS_nireq;
@@ -628,6 +651,15 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        if (FLAGS_pc && FLAGS_pc_hw) {
+            try {
+                slog::info << "Hardware performance counts of the first stream:" << slog::endl;
+                printHwPerformanceCounts(exeNetwork.GetExecGraphInfo(), std::cout);
+            } catch (const std::exception & ex) {
+                slog::err << "Can't get hardware performance counts: " << ex.what() << slog::endl;
+            }
+        }
+
         if (statistics)
             statistics->dump();
 
@@ -8,6 +8,11 @@
 #include <vector>
 #include <map>
 #include <regex>
+#include <iomanip>
+#include <sstream>
+
+#include <ngraph/function.hpp>
+#include <ngraph/variant.hpp>
 
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
@@ -173,6 +178,56 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
     return ss.str();
 }
 
+void printHwPerformanceCounts(const InferenceEngine::CNNNetwork& execGraph, std::ostream& stream) {
+    auto function = execGraph.getFunction();
+    if (!function) {
+        throw std::logic_error("Executable graph is not represented as ngraph::Function");
+    }
+
+    auto getValue = [](const std::shared_ptr<ngraph::Node>& op, const std::string& name) -> std::string {
+        const auto& rtInfo = op->get_rt_info();
+        auto it = rtInfo.find(name);
+        if (it == rtInfo.end())
+            return "";
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        return value ? value->get() : "";
+    };
+
+    bool hasHwCounters = false;
+    for (const auto& op : function->get_ordered_ops()) {
+        const auto cycles = getValue(op, "hwCycles");
+        const auto gflops = getValue(op, "estimatedGFlops");
+        if (cycles.empty() && gflops.empty())
+            continue;
+
+        std::string name = op->get_friendly_name();
+        const size_t maxLayerName = 30;
+        if (name.length() >= maxLayerName) {
+            name = name.substr(0, maxLayerName - 4) + "...";
+        }
+
+        stream << std::setw(maxLayerName) << std::left << name;
+        stream << std::setw(30) << std::left << "layerType: " + getValue(op, "layerType") + " ";
+        stream << std::setw(20) << std::left << "realTime: " + getValue(op, "execTimeMcs");
+        if (!cycles.empty()) {
+            hasHwCounters = true;
+            const auto instructions = getValue(op, "hwInstructions");
+            std::ostringstream ipc;
+            ipc << std::fixed << std::setprecision(2) << std::stod(instructions) / std::stod(cycles);
+            stream << std::setw(20) << std::left << "cycles: " + cycles;
+            stream << std::setw(25) << std::left << "instructions: " + instructions;
+            stream << std::setw(12) << std::left << "IPC: " + ipc.str();
+            stream << std::setw(22) << std::left << "LLC misses: " + getValue(op, "hwLlcMisses");
+        }
+        stream << std::setw(20) << std::left << "GFLOPS: " + gflops;
+        stream << "GB/s: " << getValue(op, "estimatedGBps") << std::endl;
+    }
+
+    if (!hasHwCounters) {
+        slog::warn << "Hardware performance counters are not available, check /proc/sys/kernel/perf_event_paranoid" << slog::endl;
+    }
+}
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
                  const std::map<std::string, std::map<std::string, std::string>>& config) {
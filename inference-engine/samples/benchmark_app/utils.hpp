@@ -17,6 +17,7 @@ bool updateShapes(InferenceEngine::ICNNNetwork::InputShapes& shapes,
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info);
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
+void printHwPerformanceCounts(const InferenceEngine::CNNNetwork& execGraph, std::ostream& stream);
 
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
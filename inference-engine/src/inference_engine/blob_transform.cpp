@@ -4,6 +4,7 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
@@ -11,6 +12,7 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 //----------------------------------------------------------------------
 
@@ -47,7 +49,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
@@ -85,40 +87,33 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     }
 #endif  // HAVE_SSE
 
+    // Every (n, h) pair covers a contiguous row in NHWC and C rows in NCHW, so threads write disjoint memory
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            for (size_t c = 0; c < C; c++) {
+                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + h * H_dst_stride;
+                const data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    dst_ptr_l[w] = *src_ptr_l;
+                    src_ptr_l += W_src_stride;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            for (size_t c = 0; c < C; c++) {
+                const data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + h * H_src_stride;
+                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + h * H_dst_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = src_ptr_l[w];
+                    dst_ptr_l += W_dst_stride;
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        parallel_for(N, [&](size_t n) {
+            std::memcpy(dst_ptr + n * C * H * W, src_ptr + n * C * H * W, C * H * W * sizeof(data_t));
+        });
     }
 }
 
@@ -219,43 +214,33 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     }
 #endif  // HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            for (size_t c = 0; c < C; c++) {
+                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride + h * H_dst_stride;
+                const data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride +
+                                          h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    dst_ptr_l[w] = *src_ptr_l;
+                    src_ptr_l += W_src_stride;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            for (size_t c = 0; c < C; c++) {
+                const data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride +
+                                          h * H_src_stride;
+                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride + h * H_dst_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = src_ptr_l[w];
+                    dst_ptr_l += W_dst_stride;
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        parallel_for(N, [&](size_t n) {
+            std::memcpy(dst_ptr + n * C * D * H * W, src_ptr + n * C * D * H * W, C * D * H * W * sizeof(data_t));
+        });
     }
 }
 
@@ -0,0 +1,115 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx2 {
+
+// Vector forms of the scalar conversions, see precision_utils.cpp for details of the algorithms.
+// F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
+// F16: exp_bias:15  SEEEEEMM MMMMMMMM
+
+static inline __m256 cvt_f16_f32(__m256i h) {
+    const __m256i exp_mask = _mm256_set1_epi32(0x7C00);
+    const __m256i man_mask = _mm256_set1_epi32(0x03FF);
+
+    __m256i s = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+    __m256i e = _mm256_and_si256(h, exp_mask);
+    __m256i m = _mm256_and_si256(h, man_mask);
+
+    // normal numbers: shift exp and mantissa and rebias exp
+    __m256i normal = _mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7FFF)), 13),
+                                      _mm256_set1_epi32((127 - 15) << 23));
+
+    // NAN and INF: keep mantissa raising 10 bit for NAN
+    __m256i m_nonzero = _mm256_xor_si256(_mm256_cmpeq_epi32(m, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+    __m256i nan_man = _mm256_or_si256(m, _mm256_and_si256(m_nonzero, _mm256_set1_epi32(0x0200)));
+    __m256i naninf = _mm256_or_si256(_mm256_slli_epi32(nan_man, 23 - 10), _mm256_set1_epi32(0x7F800000));
+
+    // zero and denormals: exact value is mantissa * 2^-24
+    __m256i denorm = _mm256_castps_si256(_mm256_mul_ps(_mm256_cvtepi32_ps(m), _mm256_set1_ps(1.0f / (1 << 24))));
+
+    __m256i is_naninf = _mm256_cmpeq_epi32(e, exp_mask);
+    __m256i is_denorm = _mm256_cmpeq_epi32(e, _mm256_setzero_si256());
+
+    __m256i u = _mm256_blendv_epi8(normal, naninf, is_naninf);
+    u = _mm256_blendv_epi8(u, denorm, is_denorm);
+    return _mm256_castsi256_ps(_mm256_or_si256(u, s));
+}
+
+static inline __m256i cvt_f32_f16(__m256 x) {
+    const __m256i exp_mask = _mm256_set1_epi32(0x7F800000);
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m256i v = _mm256_castps_si256(x);
+    __m256i s = _mm256_and_si256(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x8000));
+    v = _mm256_and_si256(v, _mm256_set1_epi32(0x7FFFFFFF));
+
+    // NAN and INF
+    __m256i is_naninf = _mm256_cmpeq_epi32(_mm256_and_si256(v, exp_mask), exp_mask);
+    __m256i m_nonzero = _mm256_xor_si256(
+            _mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x007FFFFF)), _mm256_setzero_si256()),
+            _mm256_set1_epi32(-1));
+    __m256i naninf = _mm256_or_si256(_mm256_srli_epi32(v, 23 - 10),
+                                     _mm256_and_si256(m_nonzero, _mm256_set1_epi32(0x0200)));
+
+    // round to nearest by adding half ULP of f16
+    __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(_mm256_and_si256(v, exp_mask)),
+                                    _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+    __m256 vf = _mm256_add_ps(_mm256_castsi256_ps(v), half_ulp);
+
+    __m256i is_zero = _mm256_castps_si256(_mm256_cmp_ps(vf, _mm256_mul_ps(min16, _mm256_set1_ps(0.5f)), _CMP_LT_OQ));
+    __m256i is_min = _mm256_castps_si256(_mm256_cmp_ps(vf, min16, _CMP_LT_OQ));
+    __m256i is_max = _mm256_castps_si256(_mm256_cmp_ps(vf, max16, _CMP_GE_OQ));
+
+    __m256i u = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(vf), _mm256_set1_epi32((127 - 15) << 23)), 23 - 10);
+    u = _mm256_blendv_epi8(u, _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF), is_max);
+    u = _mm256_blendv_epi8(u, _mm256_set1_epi32(1 << 10), is_min);
+    u = _mm256_blendv_epi8(u, _mm256_setzero_si256(), is_zero);
+    u = _mm256_blendv_epi8(u, naninf, is_naninf);
+    return _mm256_or_si256(u, s);
+}
+
+// Scale and bias are applied with separate rounding of multiplication and addition, not FMA,
+// to give results bit-exact with the scalar code
+size_t f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    const size_t vlen = 8;
+
+    size_t i = 0;
+    for (; i + vlen <= nelem; i += vlen) {
+        __m256i h = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        __m256 f = _mm256_add_ps(_mm256_mul_ps(cvt_f16_f32(h), vscale), vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+    return i;
+}
+
+size_t f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    const size_t vlen = 8;
+
+    size_t i = 0;
+    for (; i + vlen <= nelem; i += vlen) {
+        __m256 f = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        // NAN payload may exceed 16 bits, the scalar code truncates it
+        __m256i h = _mm256_and_si256(cvt_f32_f16(f), _mm256_set1_epi32(0xFFFF));
+        // pack works within 128-bit lanes, so the result is permuted back to the right order
+        h = _mm256_permute4x64_epi64(_mm256_packus_epi32(h, h), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(h));
+    }
+    return i;
+}
+
+}  // namespace avx2
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx512.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx512 {
+
+// Vector forms of the scalar conversions, see precision_utils.cpp for details of the algorithms.
+// F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
+// F16: exp_bias:15  SEEEEEMM MMMMMMMM
+
+static inline __m512 cvt_f16_f32(__m512i h) {
+    const __m512i exp_mask = _mm512_set1_epi32(0x7C00);
+
+    __m512i s = _mm512_slli_epi32(_mm512_and_si512(h, _mm512_set1_epi32(0x8000)), 16);
+    __m512i e = _mm512_and_si512(h, exp_mask);
+    __m512i m = _mm512_and_si512(h, _mm512_set1_epi32(0x03FF));
+
+    // normal numbers: shift exp and mantissa and rebias exp
+    __m512i u = _mm512_add_epi32(_mm512_slli_epi32(_mm512_and_si512(h, _mm512_set1_epi32(0x7FFF)), 13),
+                                 _mm512_set1_epi32((127 - 15) << 23));
+
+    // NAN and INF: keep mantissa raising 10 bit for NAN
+    __mmask16 m_nonzero = _mm512_test_epi32_mask(m, m);
+    __m512i nan_man = _mm512_mask_or_epi32(m, m_nonzero, m, _mm512_set1_epi32(0x0200));
+    __m512i naninf = _mm512_or_si512(_mm512_slli_epi32(nan_man, 23 - 10), _mm512_set1_epi32(0x7F800000));
+    u = _mm512_mask_mov_epi32(u, _mm512_cmpeq_epi32_mask(e, exp_mask), naninf);
+
+    // zero and denormals: exact value is mantissa * 2^-24
+    __m512i denorm = _mm512_castps_si512(_mm512_mul_ps(_mm512_cvtepi32_ps(m), _mm512_set1_ps(1.0f / (1 << 24))));
+    u = _mm512_mask_mov_epi32(u, _mm512_cmpeq_epi32_mask(e, _mm512_setzero_si512()), denorm);
+
+    return _mm512_castsi512_ps(_mm512_or_si512(u, s));
+}
+
+static inline __m512i cvt_f32_f16(__m512 x) {
+    const __m512i exp_mask = _mm512_set1_epi32(0x7F800000);
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 max16 = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m512i v = _mm512_castps_si512(x);
+    __m512i s = _mm512_and_si512(_mm512_srli_epi32(v, 16), _mm512_set1_epi32(0x8000));
+    v = _mm512_and_si512(v, _mm512_set1_epi32(0x7FFFFFFF));
+
+    // NAN and INF
+    __mmask16 is_naninf = _mm512_cmpeq_epi32_mask(_mm512_and_si512(v, exp_mask), exp_mask);
+    __mmask16 m_nonzero = _mm512_test_epi32_mask(v, _mm512_set1_epi32(0x007FFFFF));
+    __m512i naninf = _mm512_srli_epi32(v, 23 - 10);
+    naninf = _mm512_mask_or_epi32(naninf, m_nonzero, naninf, _mm512_set1_epi32(0x0200));
+
+    // round to nearest by adding half ULP of f16
+    __m512 half_ulp = _mm512_mul_ps(_mm512_castsi512_ps(_mm512_and_si512(v, exp_mask)),
+                                    _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23)));
+    __m512 vf = _mm512_add_ps(_mm512_castsi512_ps(v), half_ulp);
+
+    __mmask16 is_zero = _mm512_cmp_ps_mask(vf, _mm512_mul_ps(min16, _mm512_set1_ps(0.5f)), _CMP_LT_OQ);
+    __mmask16 is_min = _mm512_cmp_ps_mask(vf, min16, _CMP_LT_OQ);
+    __mmask16 is_max = _mm512_cmp_ps_mask(vf, max16, _CMP_GE_OQ);
+
+    __m512i u = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(vf), _mm512_set1_epi32((127 - 15) << 23)), 23 - 10);
+    u = _mm512_mask_mov_epi32(u, is_max, _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF));
+    u = _mm512_mask_mov_epi32(u, is_min, _mm512_set1_epi32(1 << 10));
+    u = _mm512_mask_mov_epi32(u, is_zero, _mm512_setzero_si512());
+    u = _mm512_mask_mov_epi32(u, is_naninf, naninf);
+    return _mm512_or_si512(u, s);
+}
+
+// Scale and bias are applied with separate rounding of multiplication and addition, not FMA,
+// to give results bit-exact with the scalar code
+size_t f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    const size_t vlen = 16;
+
+    size_t i = 0;
+    for (; i + vlen <= nelem; i += vlen) {
+        __m512i h = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        __m512 f = _mm512_add_ps(_mm512_mul_ps(cvt_f16_f32(h), vscale), vbias);
+        _mm512_storeu_ps(dst + i, f);
+    }
+    return i;
+}
+
+size_t f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    const size_t vlen = 16;
+
+    size_t i = 0;
+    for (; i + vlen <= nelem; i += vlen) {
+        __m512 f = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(src + i), vscale), vbias);
+        // truncating down-convert drops NAN payload bits above 16 the same way as the scalar code
+        __m256i h = _mm512_cvtepi32_epi16(cvt_f32_f16(f));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), h);
+    }
+    return i;
+}
+
+}  // namespace avx512
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stddef.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx512 {
+
+//------------------------------------------------------------------------
+//
+// FP16 <-> FP32 array conversions manually vectored for AVX-512 (w/o threads).
+// Conversions are bit-exact with scalar PrecisionUtils::f16tof32/f32tof16,
+// scale and bias are applied with fused multiply-add.
+// Every function converts the largest prefix which is a multiple of vector
+// length and returns number of converted elements, tail is left to a caller.
+//
+//------------------------------------------------------------------------
+
+size_t f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+size_t f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace avx512
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
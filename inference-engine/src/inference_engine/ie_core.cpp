@@ -23,6 +23,7 @@
 #include "ie_icore.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_profiling.hpp"
+#include "ie_tracer.hpp"
 #include "ie_util_internal.hpp"
 #include "ie_network_reader.hpp"
 #include "multi-device/multi_device_config.hpp"
@@ -742,10 +743,20 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // the tracer is shared by all devices, so its key is not passed to plugins
+    auto pluginConfig = config;
+    auto traceFile = pluginConfig.find(CONFIG_KEY(PERF_TRACE_FILE));
+    if (traceFile != pluginConfig.end()) {
+        setTraceFile(traceFile->second);
+        pluginConfig.erase(traceFile);
+        if (pluginConfig.empty())
+            return;
+    }
+
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        _impl->SetConfigForPlugins(pluginConfig, std::string());
     } else {
-        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto parsed = parseDeviceNameIntoConfig(deviceName, pluginConfig);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
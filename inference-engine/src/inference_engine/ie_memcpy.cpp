@@ -8,7 +8,6 @@
 #include <string.h>
 
 int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
-    size_t i;
     if (!src || count > destsz ||
         count > (dest > src ? ((uintptr_t)dest - (uintptr_t)src) : ((uintptr_t)src - (uintptr_t)dest))) {
         // zero out dest if error detected
@@ -16,6 +15,7 @@ int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
         return -1;
     }
 
-    for (i = 0; i < count; ++i) (reinterpret_cast<uint8_t*>(dest))[i] = (reinterpret_cast<const uint8_t*>(src))[i];
+    // regions are checked not to overlap above, so vectorized libc copy is safe
+    memcpy(dest, src, count);
     return 0;
 }
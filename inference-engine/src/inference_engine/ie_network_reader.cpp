@@ -134,6 +134,11 @@ void registerReaders() {
 
 }  // namespace
 
+int getModelPathStreamIndex() {
+    static const int index = std::ios_base::xalloc();
+    return index;
+}
+
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
     IE_PROFILING_AUTO_SCOPE(details::ReadNetwork)
     // Register readers if it is needed
@@ -149,6 +154,7 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
     std::ifstream modelStream(model_path, std::ios::binary);
     if (!modelStream.is_open())
         THROW_IE_EXCEPTION << "Model file " << modelPath << " cannot be opened!";
+    modelStream.pword(getModelPathStreamIndex()) = const_cast<std::string*>(&modelPath);
 
     // Find reader for model extension
     auto fileExt = modelPath.substr(modelPath.find_last_of(".") + 1);
@@ -95,6 +95,7 @@ template struct InferenceEngine::Parameter::RealData<std::vector<std::string>>;
 template struct InferenceEngine::Parameter::RealData<std::vector<unsigned long>>;
 template struct InferenceEngine::Parameter::RealData<std::tuple<unsigned int, unsigned int>>;
 template struct InferenceEngine::Parameter::RealData<std::tuple<unsigned int, unsigned int, unsigned int>>;
+template struct InferenceEngine::Parameter::RealData<std::map<std::string, uint64_t>>;
 template struct InferenceEngine::Parameter::RealData<InferenceEngine::Blob::Ptr>;
 #endif  // __clang__
 //
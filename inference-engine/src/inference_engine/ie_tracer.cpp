@@ -0,0 +1,250 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace InferenceEngine {
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    std::uint64_t begin;
+    std::uint64_t end;
+};
+
+/**
+ * Event slot which can be read while its thread overwrites it.
+ * The sequence is odd while the slot is written and equals 2 * (index + 1) when the event at index is complete.
+ */
+struct TraceSlot {
+    std::atomic<std::uint64_t> sequence;
+    std::atomic<const char*> name;
+    std::atomic<const char*> category;
+    std::atomic<std::uint64_t> begin;
+    std::atomic<std::uint64_t> end;
+};
+
+/**
+ * Ring buffer written only by its thread, so recording is lock-free.
+ * The oldest events are overwritten when the buffer is full.
+ */
+struct ThreadTraceBuffer {
+    static constexpr std::size_t capacity = 1 << 16;
+
+    explicit ThreadTraceBuffer(int id) : tid(id) {}
+
+    void push(const TraceEvent& event) {
+        // Memory is allocated only for threads which record events
+        if (slots == nullptr)
+            slots.reset(new TraceSlot[capacity]());
+
+        const auto h = head.load(std::memory_order_relaxed);
+        auto& slot = slots[h & (capacity - 1)];
+        slot.sequence.store(2 * h + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(event.name, std::memory_order_relaxed);
+        slot.category.store(event.category, std::memory_order_relaxed);
+        slot.begin.store(event.begin, std::memory_order_relaxed);
+        slot.end.store(event.end, std::memory_order_relaxed);
+        slot.sequence.store(2 * (h + 1), std::memory_order_release);
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    /**
+     * Copies the event at @p index if it is not being overwritten by the writer thread.
+     * Must be called only for index less than head loaded with acquire ordering, so slots are allocated.
+     */
+    bool read(std::uint64_t index, TraceEvent& event) const {
+        const auto& slot = slots[index & (capacity - 1)];
+        const auto expected = 2 * (index + 1);
+        if (slot.sequence.load(std::memory_order_acquire) != expected)
+            return false;
+
+        event.name = slot.name.load(std::memory_order_relaxed);
+        event.category = slot.category.load(std::memory_order_relaxed);
+        event.begin = slot.begin.load(std::memory_order_relaxed);
+        event.end = slot.end.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == expected;
+    }
+
+    std::unique_ptr<TraceSlot[]> slots;
+    std::atomic<std::uint64_t> head {0};
+    const int tid;
+    std::string name;  // guarded by TraceRegistry::mutex
+};
+
+constexpr std::size_t ThreadTraceBuffer::capacity;
+
+// Names are never released, so the number of them is limited in case they are generated per object
+constexpr std::size_t maxTraceNames = 4096;
+constexpr const char* overflowTraceName = "trace_names_limit_exceeded";
+
+struct TraceRegistry {
+    std::atomic<bool> enabled {false};
+
+    std::mutex mutex;
+    std::string traceFile;
+    std::uint64_t start = 0;
+    std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers;
+
+    // Separate mutex, so interning doesn't wait for the trace dump
+    std::mutex namesMutex;
+    std::unordered_set<std::string> names;
+
+    ThreadTraceBuffer* registerThread() {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.emplace_back(std::make_shared<ThreadTraceBuffer>(static_cast<int>(buffers.size())));
+        return buffers.back().get();
+    }
+
+    void dump();
+};
+
+// Never destroyed, threads may record events during static destruction
+TraceRegistry& registry() {
+    static auto instance = new TraceRegistry;
+    return *instance;
+}
+
+ThreadTraceBuffer& threadBuffer() {
+    thread_local ThreadTraceBuffer* buffer = registry().registerThread();
+    return *buffer;
+}
+
+void writeEscaped(std::ostream& os, const char* str) {
+    for (; *str != '\0'; ++str) {
+        const auto c = *str;
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        } else {
+            os << c;
+        }
+    }
+}
+
+void TraceRegistry::dump() {
+    if (traceFile.empty())
+        return;
+
+    std::ofstream file(traceFile);
+    if (!file)
+        return;
+
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first = true;
+    const auto separator = [&] {
+        if (!first)
+            file << ",";
+        file << "\n";
+        first = false;
+    };
+
+    for (const auto& buffer : buffers) {
+        if (!buffer->name.empty()) {
+            separator();
+            file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"";
+            writeEscaped(file, buffer->name.c_str());
+            file << "\"}}";
+        }
+
+        const auto head = buffer->head.load(std::memory_order_acquire);
+        const auto count = std::min<std::uint64_t>(head, ThreadTraceBuffer::capacity);
+        for (auto i = head - count; i < head; ++i) {
+            // The writer thread doesn't stop, so the oldest events may be overwritten while they are dumped
+            TraceEvent event;
+            if (!buffer->read(i, event))
+                continue;
+
+            // Events recorded before the current trace file was set belong to the previous trace
+            if (event.begin < start)
+                continue;
+
+            separator();
+            file << "{\"name\":\"";
+            writeEscaped(file, event.name);
+            file << "\",\"cat\":\"" << event.category << "\",\"pid\":0,\"tid\":" << buffer->tid
+                 << ",\"ts\":" << (event.begin - start) / 1000.0;
+            if (event.end != event.begin) {
+                file << ",\"ph\":\"X\",\"dur\":" << (event.end - event.begin) / 1000.0 << "}";
+            } else {
+                file << ",\"ph\":\"i\",\"s\":\"t\"}";
+            }
+        }
+    }
+
+    file << "\n]}\n";
+}
+
+struct TraceDumpAtExit {
+    ~TraceDumpAtExit() {
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (r.enabled.load()) {
+            r.enabled = false;
+            r.dump();
+        }
+    }
+} traceDumpAtExit;
+
+}  // namespace
+
+bool isTracingEnabled() noexcept {
+    return registry().enabled.load(std::memory_order_relaxed);
+}
+
+void setTraceFile(const std::string& traceFile) {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (r.enabled.load()) {
+        r.enabled = false;
+        r.dump();
+    }
+
+    r.traceFile = traceFile;
+    r.start = traceTimestamp();
+    r.enabled = !traceFile.empty();
+}
+
+const char* internTraceName(const std::string& name) {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.namesMutex);
+    const auto it = r.names.find(name);
+    if (it != r.names.end())
+        return it->c_str();
+    if (r.names.size() >= maxTraceNames)
+        return overflowTraceName;
+    return r.names.insert(name).first->c_str();
+}
+
+void setTraceThreadName(const std::string& name) {
+    auto& buffer = threadBuffer();
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    buffer.name = name;
+}
+
+void traceEvent(const char* name, const char* category, std::uint64_t begin, std::uint64_t end) noexcept {
+    try {
+        threadBuffer().push({name, category, begin, end});
+    } catch (...) {
+        // The event is lost if the buffer can't be allocated
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,333 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+# include <malloc.h>
+#else
+# include <sys/mman.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr size_t kAlignment = 64;
+constexpr size_t kHeaderSize = kAlignment;
+constexpr size_t kMinClassLog2 = 6;   // 64 bytes
+constexpr size_t kMaxClassLog2 = 26;  // 64 MB
+constexpr size_t kSubClasses = 4;
+constexpr size_t kNumClasses = (kMaxClassLog2 - kMinClassLog2) * kSubClasses + 1;
+constexpr size_t kNoClass = kNumClasses;
+constexpr size_t kMaxClassSize = static_cast<size_t>(1) << kMaxClassLog2;
+constexpr size_t kMaxThreadCachedSize = 256 * 1024;
+constexpr size_t kThreadCacheBytesPerClass = 1024 * 1024;
+constexpr size_t kThreadCacheBytes = 4 * 1024 * 1024;
+constexpr size_t kGlobalCacheBytes = 256 * 1024 * 1024;
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+struct BlockHeader {
+    size_t sizeClass;
+    size_t blockSize;
+    bool mapped;
+};
+static_assert(sizeof(BlockHeader) <= kHeaderSize, "Block header must fit into the alignment gap");
+
+size_t floorLog2(size_t value) {
+    size_t result = 0;
+    while (value >>= 1) result++;
+    return result;
+}
+
+size_t sizeClassIndex(size_t size) {
+    if (size <= (static_cast<size_t>(1) << kMinClassLog2))
+        return 0;
+    const size_t log2 = floorLog2(size - 1);
+    const size_t base = static_cast<size_t>(1) << log2;
+    const size_t step = base / kSubClasses;
+    return (log2 - kMinClassLog2) * kSubClasses + (size - 1 - base) / step + 1;
+}
+
+size_t classSize(size_t sizeClass) {
+    if (sizeClass == 0)
+        return static_cast<size_t>(1) << kMinClassLog2;
+    const size_t base = static_cast<size_t>(1) << (kMinClassLog2 + (sizeClass - 1) / kSubClasses);
+    return base + ((sizeClass - 1) % kSubClasses + 1) * (base / kSubClasses);
+}
+
+void* systemAlloc(size_t blockSize, bool& mapped) {
+    mapped = false;
+#ifdef _WIN32
+    return _aligned_malloc(blockSize, kAlignment);
+#else
+    if (blockSize >= kHugePageSize) {
+        void* ptr = mmap(nullptr, blockSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr != MAP_FAILED) {
+# ifdef MADV_HUGEPAGE
+            // Only an advice, kernel may not have transparent huge pages enabled
+            madvise(ptr, blockSize, MADV_HUGEPAGE);
+# endif
+            mapped = true;
+            return ptr;
+        }
+    }
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, kAlignment, blockSize) == 0 ? ptr : nullptr;
+#endif
+}
+
+void systemFree(void* block) {
+    auto header = reinterpret_cast<BlockHeader*>(block);
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    if (header->mapped) {
+        munmap(block, header->blockSize);
+    } else {
+        std::free(block);
+    }
+#endif
+}
+
+struct Counters {
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> deallocations{0};
+    std::atomic<size_t> poolHits{0};
+    std::atomic<size_t> bytesInUse{0};
+    std::atomic<size_t> bytesCached{0};
+    std::atomic<size_t> bytesThreadCached{0};
+    // Incremented by trim(), thread caches compare it with the value they have seen to release their blocks
+    std::atomic<size_t> trimEpoch{0};
+};
+
+Counters& counters() {
+    static Counters* instance = new Counters();
+    return *instance;
+}
+
+class GlobalPool {
+public:
+    static GlobalPool& instance() {
+        // Intentionally never destroyed: blobs owned by static objects may be freed after static destructors
+        static GlobalPool* pool = new GlobalPool();
+        return *pool;
+    }
+
+    void* pop(size_t sizeClass) {
+        auto& bin = bins[sizeClass];
+        std::lock_guard<std::mutex> lock(bin.mutex);
+        if (bin.blocks.empty())
+            return nullptr;
+        void* block = bin.blocks.back();
+        bin.blocks.pop_back();
+        counters().bytesCached -= classSize(sizeClass);
+        return block;
+    }
+
+    bool push(size_t sizeClass, void* block) {
+        const size_t size = classSize(sizeClass);
+        if (counters().bytesCached.fetch_add(size) + size > kGlobalCacheBytes) {
+            counters().bytesCached -= size;
+            return false;
+        }
+        try {
+            auto& bin = bins[sizeClass];
+            std::lock_guard<std::mutex> lock(bin.mutex);
+            bin.blocks.push_back(block);
+        } catch (...) {
+            counters().bytesCached -= size;
+            return false;
+        }
+        return true;
+    }
+
+    void trim() {
+        for (size_t sizeClass = 0; sizeClass < kNumClasses; sizeClass++) {
+            auto& bin = bins[sizeClass];
+            std::lock_guard<std::mutex> lock(bin.mutex);
+            for (auto block : bin.blocks) {
+                systemFree(block);
+            }
+            counters().bytesCached -= bin.blocks.size() * classSize(sizeClass);
+            bin.blocks.clear();
+        }
+    }
+
+private:
+    struct Bin {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+    std::array<Bin, kNumClasses> bins;
+};
+
+thread_local bool threadCacheDestroyed = false;
+
+class ThreadCache {
+public:
+    ThreadCache() : epoch(counters().trimEpoch.load()) {}
+
+    ~ThreadCache() {
+        // Blocks of the exiting thread are given to other threads through the global cache
+        for (size_t sizeClass = 0; sizeClass < kNumClasses; sizeClass++) {
+            for (auto block : bins[sizeClass]) {
+                if (!GlobalPool::instance().push(sizeClass, block))
+                    systemFree(block);
+            }
+        }
+        counters().bytesThreadCached -= bytes;
+        threadCacheDestroyed = true;
+    }
+
+    void* pop(size_t sizeClass) {
+        auto& bin = bins[sizeClass];
+        if (bin.empty())
+            return nullptr;
+        void* block = bin.back();
+        bin.pop_back();
+        bytes -= classSize(sizeClass);
+        counters().bytesThreadCached -= classSize(sizeClass);
+        return block;
+    }
+
+    bool push(size_t sizeClass, void* block) {
+        auto& bin = bins[sizeClass];
+        const size_t size = classSize(sizeClass);
+        if ((bin.size() + 1) * size > kThreadCacheBytesPerClass || bytes + size > kThreadCacheBytes)
+            return false;
+        try {
+            bin.push_back(block);
+        } catch (...) {
+            return false;
+        }
+        bytes += size;
+        counters().bytesThreadCached += size;
+        return true;
+    }
+
+    void trim() {
+        for (auto& bin : bins) {
+            for (auto block : bin) {
+                systemFree(block);
+            }
+            bin.clear();
+        }
+        counters().bytesThreadCached -= bytes;
+        bytes = 0;
+    }
+
+    // Releases the cached blocks if trim() was called by any thread since the last check
+    void syncWithTrim() {
+        const size_t trimEpoch = counters().trimEpoch.load(std::memory_order_relaxed);
+        if (epoch != trimEpoch) {
+            epoch = trimEpoch;
+            trim();
+        }
+    }
+
+private:
+    std::array<std::vector<void*>, kNumClasses> bins;
+    size_t bytes = 0;
+    size_t epoch = 0;
+};
+
+ThreadCache* threadCache() {
+    // Blobs may be freed by destructors of other thread local objects after the cache is gone
+    if (threadCacheDestroyed)
+        return nullptr;
+    thread_local ThreadCache cache;
+    cache.syncWithTrim();
+    return &cache;
+}
+
+}  // namespace
+
+void* PooledMemoryAllocator::alloc(size_t size) noexcept {
+    if (size > std::numeric_limits<size_t>::max() - kHeaderSize)
+        return nullptr;
+    try {
+        const size_t sizeClass = size <= kMaxClassSize ? sizeClassIndex(size) : kNoClass;
+        const size_t payload = sizeClass == kNoClass ? size : classSize(sizeClass);
+
+        void* block = nullptr;
+        if (sizeClass != kNoClass) {
+            if (payload <= kMaxThreadCachedSize) {
+                if (auto cache = threadCache())
+                    block = cache->pop(sizeClass);
+            }
+            if (!block)
+                block = GlobalPool::instance().pop(sizeClass);
+            if (block)
+                counters().poolHits++;
+        }
+        if (!block) {
+            const size_t blockSize = payload + kHeaderSize;
+            bool mapped = false;
+            block = systemAlloc(blockSize, mapped);
+            if (!block)
+                return nullptr;
+            new (block) BlockHeader{sizeClass, blockSize, mapped};
+        }
+
+        counters().allocations++;
+        counters().bytesInUse += payload;
+        return static_cast<char*>(block) + kHeaderSize;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool PooledMemoryAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    void* block = static_cast<char*>(handle) - kHeaderSize;
+    auto header = reinterpret_cast<BlockHeader*>(block);
+    const size_t sizeClass = header->sizeClass;
+    const size_t payload = sizeClass == kNoClass ? header->blockSize - kHeaderSize : classSize(sizeClass);
+
+    counters().deallocations++;
+    counters().bytesInUse -= payload;
+
+    if (sizeClass != kNoClass) {
+        if (payload <= kMaxThreadCachedSize) {
+            auto cache = threadCache();
+            if (cache && cache->push(sizeClass, block))
+                return true;
+        }
+        if (GlobalPool::instance().push(sizeClass, block))
+            return true;
+    }
+    systemFree(block);
+    return true;
+}
+
+PooledAllocatorStatistics PooledMemoryAllocator::getStatistics() noexcept {
+    PooledAllocatorStatistics statistics;
+    statistics.allocations = counters().allocations;
+    statistics.deallocations = counters().deallocations;
+    statistics.poolHits = counters().poolHits;
+    statistics.bytesInUse = counters().bytesInUse;
+    statistics.bytesCached = counters().bytesCached;
+    statistics.bytesThreadCached = counters().bytesThreadCached;
+    return statistics;
+}
+
+void PooledMemoryAllocator::trim() noexcept {
+    counters().trimEpoch++;
+    if (auto cache = threadCache())
+        cache->trim();
+    GlobalPool::instance().trim();
+}
+
+}  // namespace InferenceEngine
@@ -7,19 +7,120 @@
 
 #include <stdint.h>
 
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+#endif
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512)
+#if defined(_WIN32) || defined(WIN32)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
+namespace {
+
+// This file is also built into the legacy library which doesn't link with the one implementing
+// with_cpu_x86_* functions from ie_system_conf.h, so ISA is checked here with cpuid directly.
+// Kernels are used only if both the CPU and the OS, which saves the vector registers on context switch, support them.
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512)
+void cpuid(unsigned int leaf, unsigned int regs[4]) {
+#if defined(_WIN32) || defined(WIN32)
+    __cpuidex(reinterpret_cast<int*>(regs), leaf, 0);
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Register states enabled by the OS in XCR0
+uint64_t os_enabled_states() {
+    unsigned int regs[4];
+    cpuid(1, regs);
+    if (!(regs[2] & (1U << 27)))  // OSXSAVE
+        return 0;
+#if defined(_WIN32) || defined(WIN32)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+bool has_isa(unsigned int ext_features_bit, uint64_t states) {
+    unsigned int regs[4];
+    cpuid(0, regs);
+    if (regs[0] < 7 || (os_enabled_states() & states) != states)
+        return false;
+    cpuid(7, regs);
+    return (regs[1] & (1U << ext_features_bit)) != 0;
+}
+#endif
+
+#ifdef HAVE_AVX2
+bool with_avx2() {
+    // AVX2 flag, XMM and YMM states
+    static const bool avx2 = has_isa(5, 0x6);
+    return avx2;
+}
+#endif
+
+#ifdef HAVE_AVX512
+bool with_avx512f() {
+    // AVX512F flag, XMM, YMM, opmask and ZMM states
+    static const bool avx512f = has_isa(16, 0xE6);
+    return avx512f;
+}
+#endif
+
+// Converts the head of the array with the widest kernel supported by the CPU, returns the number of converted elements
+size_t vectorizedF16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_AVX512
+    if (with_avx512f())
+        return avx512::f16tof32Arrays(dst, src, nelem, scale, bias);
+#endif
+#ifdef HAVE_AVX2
+    if (with_avx2())
+        return avx2::f16tof32Arrays(dst, src, nelem, scale, bias);
+#endif
+    return 0;
+}
+
+size_t vectorizedF32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_AVX512
+    if (with_avx512f())
+        return avx512::f32tof16Arrays(dst, src, nelem, scale, bias);
+#endif
+#ifdef HAVE_AVX2
+    if (with_avx2())
+        return avx2::f32tof16Arrays(dst, src, nelem, scale, bias);
+#endif
+    return 0;
+}
+
+}  // namespace
+
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    size_t i = vectorizedF16tof32Arrays(dst, src, nelem, scale, bias);
+
     const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
 
-    for (size_t i = 0; i < nelem; i++) {
+    for (; i < nelem; i++) {
         dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
     }
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
+    size_t i = vectorizedF32tof16Arrays(dst, src, nelem, scale, bias);
+
+    for (; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
 }
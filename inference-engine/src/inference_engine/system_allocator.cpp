@@ -3,12 +3,13 @@
 //
 
 #include "system_allocator.hpp"
+#include "pooled_allocator.hpp"
 
 namespace InferenceEngine {
 
 IAllocator* CreateDefaultAllocator() noexcept {
     try {
-        return new SystemMemoryAllocator();
+        return new PooledMemoryAllocator();
     } catch (...) {
         return nullptr;
     }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
@@ -12,9 +13,14 @@
 #include <atomic>
 #include <climits>
 #include <cassert>
+#include <chrono>
 #include <utility>
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
 #include "threading/ie_thread_local.hpp"
 #include "ie_profiling.hpp"
+#include "ie_tracer.hpp"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #include "threading/ie_thread_affinity.hpp"
@@ -23,6 +29,17 @@
 #include "threading/ie_cpu_streams_executor.hpp"
 
 namespace InferenceEngine {
+namespace {
+// Hints the core that the thread spins, so the sibling hyper-thread gets more resources
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -138,8 +155,18 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    struct Worker {
+        std::shared_ptr<Stream>     _stream;    // created by the worker thread
+        std::mutex                  _executeMutex;  // held while a task is executed using the stream
+        std::queue<Task>            _taskQueue;  // tasks pinned to the stream, guarded by Impl::_mutex
+        std::condition_variable     _queueCondVar;  // wakes up only this worker
+        bool                        _waiting = false;  // the worker sleeps on _queueCondVar, guarded by Impl::_mutex
+        std::atomic<std::uint64_t>  _enqueuedTasks{0};  // number of tasks ever pinned to the stream
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
+        _traceName{internTraceName(_config._name)},
         _streams([this] {
             return std::make_shared<Impl::Stream>(this);
         }) {
@@ -149,33 +176,137 @@ struct CPUStreamsExecutor::Impl {
                                       static_cast<std::size_t>(_config._streams)),
                              numaNodes.size()),
                     std::back_inserter(_usedNumaNodes));
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _workers.emplace_back(new Worker);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
-                annotateSetThreadName((_config._name + "_" + std::to_string(streamId)).c_str());
+                const auto threadName = _config._name + "_" + std::to_string(streamId);
+                annotateSetThreadName(threadName.c_str());
+                setTraceThreadName(threadName);
+                auto& worker = *_workers[streamId];
+                {
+                    auto stream = _streams.local();
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    worker._stream = std::move(stream);
+                }
+                _workerReadyCondVar.notify_one();
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        if (_config._spinWaitTime > 0 && !HasTasks(worker) && !_isStopped) {
+                            const auto pinnedTasks = worker._enqueuedTasks.load();
+                            const auto sharedTasks = _enqueuedTasks.load();
+                            lock.unlock();
+                            SpinWait(worker, pinnedTasks, sharedTasks);
+                            lock.lock();
+                        }
+                        while (!HasTasks(worker) && !(stopped = _isStopped)) {
+                            worker._waiting = true;
+                            worker._queueCondVar.wait(lock);
+                            worker._waiting = false;
+                        }
+                        auto& taskQueue = worker._taskQueue.empty() ? _taskQueue : worker._taskQueue;
+                        if (!taskQueue.empty()) {
+                            task = std::move(taskQueue.front());
+                            taskQueue.pop();
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        IE_TRACE_SCOPE(_traceName, "executor");
+                        std::lock_guard<std::mutex> lock(worker._executeMutex);
+                        Execute(task, *worker._stream);
                     }
                 }
             });
         }
+        // Streams of workers should exist before tasks are executed with them in other threads
+        std::unique_lock<std::mutex> lock(_mutex);
+        _workerReadyCondVar.wait(lock, [&] {
+            return std::all_of(_workers.begin(), _workers.end(), [](const std::unique_ptr<Worker>& worker) {
+                return worker->_stream != nullptr;
+            });
+        });
+    }
+
+    bool HasTasks(const Worker& worker) const {
+        return !worker._taskQueue.empty() || !_taskQueue.empty();
+    }
+
+    Worker& GetWorker(int streamIndex) {
+        if (streamIndex < 0 || streamIndex >= static_cast<int>(_workers.size())) {
+            THROW_IE_EXCEPTION << "Wrong stream index " << streamIndex << " for " << _config._name
+                               << ". Expected only values in range [0, " << _workers.size() << ")";
+        }
+        return *_workers[streamIndex];
+    }
+
+    // Polls the queue of the worker and the shared one with bounded exponential backoff, so a stream picks up a task
+    // without the wake up latency of the condition variable. Tasks pinned to other streams don't interrupt it.
+    // Gives up after Config::_spinWaitTime.
+    void SpinWait(const Worker& worker, std::uint64_t pinnedTasks, std::uint64_t sharedTasks) {
+        constexpr int maxPauses = 64;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds{_config._spinWaitTime};
+        for (int pauses = 1;
+             worker._enqueuedTasks.load() == pinnedTasks && _enqueuedTasks.load() == sharedTasks && !_isStopped;) {
+            if (pauses <= maxPauses) {
+                for (int i = 0; i < pauses; ++i) {
+                    CpuRelax();
+                }
+                pauses *= 2;
+            } else {
+                std::this_thread::yield();
+            }
+            if (std::chrono::steady_clock::now() > deadline) {
+                break;
+            }
+        }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, int streamIndex = -1) {
+        traceInstant(_traceName, "queue");
+        Worker* sleepingWorker = nullptr;
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            if (streamIndex < 0) {
+                _taskQueue.emplace(std::move(task));
+                // Workers which don't sleep check the shared queue before they do, so one sleeping worker is enough
+                auto it = std::find_if(_workers.begin(), _workers.end(), [](const std::unique_ptr<Worker>& worker) {
+                    return worker->_waiting;
+                });
+                if (it != _workers.end()) {
+                    sleepingWorker = it->get();
+                }
+                ++_enqueuedTasks;
+            } else {
+                sleepingWorker = &GetWorker(streamIndex);
+                sleepingWorker->_taskQueue.emplace(std::move(task));
+                ++sleepingWorker->_enqueuedTasks;
+            }
+            if (nullptr != sleepingWorker) {
+                // The next task goes to another sleeping worker even if this one has not woken up yet
+                sleepingWorker->_waiting = false;
+            }
+        }
+        if (nullptr != sleepingWorker) {
+            sleepingWorker->_queueCondVar.notify_one();
+        }
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        for (auto& worker : _workers) {
+            worker->_queueCondVar.notify_one();
+        }
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -207,14 +338,17 @@ struct CPUStreamsExecutor::Impl {
     }
 
     Config                                  _config;
+    const char*                             _traceName = nullptr;
     std::mutex                              _streamIdMutex;
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
-    std::condition_variable                 _queueCondVar;
+    std::condition_variable                 _workerReadyCondVar;
     std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::vector<std::unique_ptr<Worker>>    _workers;
+    std::atomic<std::uint64_t>              _enqueuedTasks{0};  // number of tasks ever put to the shared queue
+    std::atomic<bool>                       _isStopped{false};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
@@ -235,16 +369,7 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 }
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
-    for (auto& thread : _impl->_threads) {
-        if (thread.joinable()) {
-            thread.join();
-        }
-    }
+    _impl->Stop();
 }
 
 void CPUStreamsExecutor::Execute(Task task) {
@@ -259,4 +384,31 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run(Task task, int streamIndex) {
+    _impl->Enqueue(std::move(task), streamIndex);
+}
+
+void CPUStreamsExecutor::Execute(Task task, int streamIndex) {
+    auto& worker = _impl->GetWorker(streamIndex);
+    if (_impl->_threads[streamIndex].get_id() == std::this_thread::get_id()) {
+        // The stream thread already holds the stream
+        _impl->Execute(task, *worker._stream);
+    } else {
+        std::lock_guard<std::mutex> lock(worker._executeMutex);
+#if IE_THREAD == IE_THREAD_OMP
+        // The number of OpenMP threads is set per thread, so the calling thread takes the one of the stream
+        struct NumThreadsGuard {
+            explicit NumThreadsGuard(int numThreads) : _prevNumThreads{omp_get_max_threads()} {
+                omp_set_num_threads(numThreads);
+            }
+            ~NumThreadsGuard() {
+                omp_set_num_threads(_prevNumThreads);
+            }
+            int _prevNumThreads;
+        } numThreadsGuard{0 != _impl->_config._threadsPerStream ? _impl->_config._threadsPerStream : omp_get_max_threads()};
+#endif
+        _impl->Execute(task, *worker._stream);
+    }
+}
+
 }  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <exception>
 #include <unordered_set>
 
 #include <cnn_network_ngraph_impl.hpp>
@@ -27,6 +28,7 @@
 #include "ngraph_ops/proposal_ie.hpp"
 #include "ngraph_ops/relu_ie.hpp"
 #include "ngraph_ops/scaleshift.hpp"
+#include "ngraph_ops/scaled_dot_product_attention_ie.hpp"
 #include "ngraph_ops/tile_ie.hpp"
 #include "ngraph_ops/hard_sigmoid_ie.hpp"
 #include "ngraph_ops/nms_ie.hpp"
@@ -38,6 +40,7 @@
 #include "exec_graph_info.hpp"
 
 #include "ie_profiling.hpp"
+#include "ie_parallel.hpp"
 #include "ie_cnn_layer_builder_ngraph.h"
 
 #include <debug.h>
@@ -593,6 +596,7 @@ std::shared_ptr<CNNNetworkImpl> convertFunctionToICNNNetwork(const std::shared_p
                 std::make_shared<Builder::NodeConverter<::ngraph::op::ROIPooling>>(),
                 std::make_shared<Builder::NodeConverter<::ngraph::op::PSROIPooling>>(),
                 std::make_shared<Builder::NodeConverter<::ngraph::op::ScaleShiftIE>>(),
+                std::make_shared<Builder::NodeConverter<::ngraph::op::ScaledDotProductAttentionIE>>(),
                 std::make_shared<Builder::NodeConverter<::ngraph::op::ShapeOf>>(),
                 std::make_shared<Builder::NodeConverter<::ngraph::op::Sigmoid>>(),
                 std::make_shared<Builder::NodeConverter<::ngraph::op::Sin>>(),
@@ -724,38 +728,71 @@ std::shared_ptr<CNNNetworkImpl> convertFunctionToICNNNetwork(const std::shared_p
 
     bool keep_constants = keep_constant_inputs || ::ngraph::op::util::has_op_with_type<::ngraph::op::FakeQuantize>(graph);
 
-    // Create layers and output data
+    // Converters read names of neighbour nodes which are shared between several layers (e.g. weights constants
+    // or consumers of constants from the original function), and Node::get_name() lazily writes the unique name
+    // on the first call. Set all names and rt info before the parallel region, so shared nodes are only read there.
     for (const auto &layer : nodes) {
-        if (isInternalLayer(layer, op_names, keep_constants)) continue;
+        layer->get_name();
+        for (const auto &input : layer->input_values())
+            input.get_node()->get_name();
+        for (const auto &output : layer->outputs())
+            for (const auto &consumer : output.get_target_inputs())
+                consumer.get_node()->get_name();
 
         // TODO: remove this rt info when all blobs will be inputs
         auto &rt_info = layer->get_rt_info();
         rt_info["keep_constants"] = std::make_shared<::ngraph::VariantWrapper<int64_t>> (keep_constants);
+    }
 
-        CNNLayerPtr cnnLayer = createCNNLayer(layer);
-
-        // Set originalLayersNames from FusedNames
-        std::string originalNames = ::ngraph::getFusedNames(layer);
-        if (!originalNames.empty()) {
-            cnnLayer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalNames;
-        }
+    // Create layers. Converters modify only the layer they create, so layers are created in parallel.
+    // Constants are not copied: Const layers and weights blobs share the data of ngraph::op::Constant.
+    std::vector<CNNLayerPtr> cnnLayers(nodes.size());
+    std::vector<std::exception_ptr> exceptions(nodes.size());
+    parallel_for(nodes.size(), [&](size_t idx) {
+        const auto &layer = nodes[idx];
+        try {
+            if (isInternalLayer(layer, op_names, keep_constants)) return;
+
+            const auto &rt_info = layer->get_rt_info();
+            CNNLayerPtr cnnLayer = createCNNLayer(layer);
+
+            // Set originalLayersNames from FusedNames
+            std::string originalNames = ::ngraph::getFusedNames(layer);
+            if (!originalNames.empty()) {
+                cnnLayer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalNames;
+            }
 
-        std::string primitivesPriority = ::ngraph::getPrimitivesPriority(layer);
-        if (!primitivesPriority.empty()) {
-            cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
-        }
+            std::string primitivesPriority = ::ngraph::getPrimitivesPriority(layer);
+            if (!primitivesPriority.empty()) {
+                cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
+            }
 
-        // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
-        using VariantString = ::ngraph::VariantWrapper<std::string>;
-        for (const auto &rt : rt_info) {
-            if (auto str_attr = std::dynamic_pointer_cast<VariantString>(rt.second)) {
-                if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
-                    cnnLayer->affinity = str_attr->get();
-                } else {
-                    cnnLayer->params[rt.first] = str_attr->get();
+            // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
+            using VariantString = ::ngraph::VariantWrapper<std::string>;
+            for (const auto &rt : rt_info) {
+                if (auto str_attr = std::dynamic_pointer_cast<VariantString>(rt.second)) {
+                    if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
+                        cnnLayer->affinity = str_attr->get();
+                    } else {
+                        cnnLayer->params[rt.first] = str_attr->get();
+                    }
                 }
             }
+            cnnLayers[idx] = cnnLayer;
+        } catch (...) {
+            exceptions[idx] = std::current_exception();
         }
+    });
+    // Report the error of the first node in topological order to keep messages deterministic
+    for (const auto &exception : exceptions) {
+        if (exception) std::rethrow_exception(exception);
+    }
+
+    // Create output data sequentially to keep data names and layers order stable
+    for (size_t idx = 0; idx < nodes.size(); idx++) {
+        const auto &layer = nodes[idx];
+        CNNLayerPtr cnnLayer = cnnLayers[idx];
+        if (!cnnLayer) continue;
 
         size_t inputCount(0);
         for (size_t i = 0; i < layer->get_input_size(); i++) {
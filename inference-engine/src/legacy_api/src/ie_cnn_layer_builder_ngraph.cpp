@@ -37,6 +37,7 @@
 #include "ngraph_ops/proposal_ie.hpp"
 #include "ngraph_ops/relu_ie.hpp"
 #include "ngraph_ops/selu_ie.hpp"
+#include "ngraph_ops/scaled_dot_product_attention_ie.hpp"
 #include "ngraph_ops/scaleshift.hpp"
 #include "ngraph_ops/tile_ie.hpp"
 #include "ngraph_ops/topk_ie.hpp"
@@ -1236,6 +1237,21 @@ CNNLayer::Ptr NodeConverter<ngraph::op::GatherTreeIE>::createLayer(const std::sh
     return res;
 }
 
+template <>
+CNNLayer::Ptr NodeConverter<ngraph::op::ScaledDotProductAttentionIE>::createLayer(const std::shared_ptr<ngraph::Node>& layer) const {
+    LayerParams params = {layer->get_friendly_name(), "ScaledDotProductAttention",
+                          details::convertPrecision(layer->get_output_element_type(0))};
+    auto res = std::make_shared<InferenceEngine::CNNLayer>(params);
+
+    auto castedLayer = ngraph::as_type_ptr<ngraph::op::ScaledDotProductAttentionIE>(layer);
+    if (castedLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get " << params.type << " layer " << params.name;
+
+    res->params["scale"] = asString(castedLayer->get_scale());
+    res->params["transpose_key"] = castedLayer->get_transpose_key() ? "true" : "false";
+    return res;
+}
+
 template <>
 CNNLayer::Ptr NodeConverter<ngraph::op::ReverseSequence>::createLayer(const std::shared_ptr<ngraph::Node>& layer) const {
     LayerParams params = {layer->get_friendly_name(), "ReverseSequence", details::convertPrecision(layer->get_output_element_type(0))};
@@ -12,6 +12,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 
 #include <cpp_interfaces/exception2status.hpp>
@@ -44,6 +45,18 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_HW_COUNTERS) {
+            if (val == PluginConfigParams::YES) collectHwCounters = true;
+            else if (val == PluginConfigParams::NO) collectHwCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HW_COUNTERS
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_LOW_LATENCY) {
+            if (val == PluginConfigParams::YES) lowLatency = true;
+            else if (val == PluginConfigParams::NO) lowLatency = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_LOW_LATENCY
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -58,6 +71,48 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION) {
+            if (val == PluginConfigParams::YES) optimizeLayouts = true;
+            else if (val == PluginConfigParams::NO) optimizeLayouts = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR) {
+            // empty string means that the file-backed store is switched off
+            weightsCacheDir = val;
+        } else if (key == CPUConfigParams::KEY_CPU_AUTO_TUNE) {
+            if (val == CPUConfigParams::CPU_TUNE_THROUGHPUT) autoTune = AutoTuneMode::Throughput;
+            else if (val == CPUConfigParams::CPU_TUNE_LATENCY) autoTune = AutoTuneMode::Latency;
+            else if (val == PluginConfigParams::NO) autoTune = AutoTuneMode::Off;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_TUNE
+                                   << ". Expected only CPU_TUNE_THROUGHPUT/CPU_TUNE_LATENCY/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_AUTO_TUNE_LATENCY_SLA) {
+            float val_f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_TUNE_LATENCY_SLA
+                                   << ". Expected only non negative numbers (ms)";
+            }
+            if (val_f < 0.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_TUNE_LATENCY_SLA
+                                   << ". Expected only non negative numbers (ms)";
+            autoTuneLatencySLA = val_f;
+        } else if (key == CPUConfigParams::KEY_CPU_AUTO_TUNE_TIME) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_TUNE_TIME
+                                   << ". Expected only positive numbers (ms)";
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_TUNE_TIME
+                                   << ". Expected only positive numbers (ms)";
+            autoTuneTime = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_AUTO_TUNE_CACHE) {
+            autoTuneCache = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -111,6 +166,14 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::NO });
+        if (collectHwCounters == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_HW_COUNTERS, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_HW_COUNTERS, PluginConfigParams::NO });
+        if (lowLatency == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_LOW_LATENCY, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_LOW_LATENCY, PluginConfigParams::NO });
         if (exclusiveAsyncRequests == true)
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES });
         else
@@ -120,6 +183,26 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (optimizeLayouts == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, PluginConfigParams::NO });
+
+        _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, weightsCacheDir });
+        switch (autoTune) {
+            case AutoTuneMode::Off:
+                _config.insert({ CPUConfigParams::KEY_CPU_AUTO_TUNE, PluginConfigParams::NO });
+            break;
+            case AutoTuneMode::Throughput:
+                _config.insert({ CPUConfigParams::KEY_CPU_AUTO_TUNE, CPUConfigParams::CPU_TUNE_THROUGHPUT });
+            break;
+            case AutoTuneMode::Latency:
+                _config.insert({ CPUConfigParams::KEY_CPU_AUTO_TUNE, CPUConfigParams::CPU_TUNE_LATENCY });
+            break;
+        }
+        _config.insert({ CPUConfigParams::KEY_CPU_AUTO_TUNE_LATENCY_SLA, std::to_string(autoTuneLatencySLA) });
+        _config.insert({ CPUConfigParams::KEY_CPU_AUTO_TUNE_TIME, std::to_string(autoTuneTime) });
+        _config.insert({ CPUConfigParams::KEY_CPU_AUTO_TUNE_CACHE, autoTuneCache });
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
@@ -12,6 +12,7 @@ namespace MKLDNNPlugin {
 
 struct Config {
     Config() {
+        streamExecutorConfig._name = "CPUStreamsExecutor";
 #if (defined(__APPLE__) || defined(_WIN32))
         streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::NUMA;
 #else
@@ -25,12 +26,28 @@ struct Config {
         On,
     };
 
+    enum class AutoTuneMode {
+        Off,
+        Throughput,
+        Latency,
+    };
+
     bool collectPerfCounters = false;
+    bool collectHwCounters = false;
     bool exclusiveAsyncRequests = false;
+    bool lowLatency = false;
     bool enableDynamicBatch = false;
+    bool optimizeLayouts = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
+    std::string weightsCacheDir = "";
+    // Set on load if other networks of the plugin are alive and may share prepacked weights with this one
+    bool shareWeightsAcrossNetworks = false;
+    AutoTuneMode autoTune = AutoTuneMode::Off;
+    float autoTuneLatencySLA = 0.f;
+    int autoTuneTime = 500;
+    std::string autoTuneCache = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
@@ -4,14 +4,73 @@
 
 #include "mkldnn_async_infer_request.h"
 #include <memory>
+#include <utility>
+
+namespace {
+
+// Runs all tasks by one stream of the streams executor
+class StreamTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    StreamTaskExecutor(const InferenceEngine::CPUStreamsExecutor::Ptr& executor, int streamIndex)
+        : _executor(executor), _streamIndex(streamIndex) {}
+
+    void run(InferenceEngine::Task task) override {
+        _executor->run(std::move(task), _streamIndex);
+    }
+
+private:
+    InferenceEngine::CPUStreamsExecutor::Ptr _executor;
+    int _streamIndex;
+};
+
+}  // namespace
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {}
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr& preprocessExecutor)
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+          _inferRequest(std::dynamic_pointer_cast<MKLDNNInferRequest>(inferRequest)) {
+    IE_ASSERT(_inferRequest != nullptr);
+
+    auto inferExecutor = taskExecutor;
+    if (_inferRequest->GetStreamIndex() >= 0) {
+        _streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(taskExecutor);
+        IE_ASSERT(_streamsExecutor != nullptr);
+        inferExecutor = std::make_shared<StreamTaskExecutor>(_streamsExecutor, _inferRequest->GetStreamIndex());
+    }
+
+    _inferPipeline = {
+        {inferExecutor, [this] { _inferRequest->InferImpl(); }}
+    };
+    if (preprocessExecutor) {
+        _pipeline = {
+            {preprocessExecutor, [this] { _inferRequest->PreprocessInputs(); }},
+            {inferExecutor, [this] { _inferRequest->InferGraph(); }}
+        };
+    } else {
+        _pipeline = _inferPipeline;
+    }
+    _hasPreprocessStage = preprocessExecutor != nullptr;
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    _inferRequest->checkBlobs();
+    if (_hasPreprocessStage && _inferRequest->NeedsPreprocessing()) {
+        RunFirstStage(_pipeline.begin(), _pipeline.end(), _callbackExecutor);
+    } else {
+        RunFirstStage(_inferPipeline.begin(), _inferPipeline.end(), _callbackExecutor);
+    }
+}
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
-    InferUsingAsync();
+    if (nullptr == _streamsExecutor) {
+        InferUsingAsync();
+        return;
+    }
+    // The calling thread takes the stream of the request, so no stream thread is woken up
+    _inferRequest->checkBlobs();
+    _streamsExecutor->Execute([this] { _inferRequest->InferImpl(); }, _inferRequest->GetStreamIndex());
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -7,19 +7,40 @@
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include "mkldnn_infer_request.h"
 
 namespace MKLDNNPlugin {
 
+/**
+ * With a single stream the pipeline of the request consists of input pre-processing stage run by a separate executor
+ * and inference stage run by the stream executor, so pre-processing of one request overlaps inference of others.
+ * Requests without pre-processing work skip the first stage to avoid the extra thread switch.
+ * Blobs of a request are not double-buffered: a request can't be started again before it completes, so stages of
+ * different inferences overlap only between requests, each of which owns its blobs.
+ * With several streams (preprocessExecutor is null) requests are pre-processed within their streams.
+ * In low latency mode the request is pinned to one stream and the synchronous Infer() runs on the calling thread
+ * within the task arena of that stream.
+ */
 class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &preprocessExecutor);
 
     void Infer_ThreadUnsafe() override;
 
     ~MKLDNNAsyncInferRequest() override;
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+
+private:
+    MKLDNNInferRequest::Ptr _inferRequest;
+    Pipeline _inferPipeline;
+    bool _hasPreprocessStage = false;
+    InferenceEngine::CPUStreamsExecutor::Ptr _streamsExecutor;
 };
 
 }  // namespace MKLDNNPlugin
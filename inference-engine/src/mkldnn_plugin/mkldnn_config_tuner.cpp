@@ -0,0 +1,292 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_config_tuner.h"
+#include "mkldnn_weights_cache.hpp"
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+#include <graph_tools.hpp>
+#include <threading/ie_executor_manager.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+using Time = std::chrono::steady_clock;
+
+const char tuningExecutorName[] = "CPUTuningStreamsExecutor";
+
+void fillInputs(const IInferRequest::Ptr& request, const InputsDataMap& inputs) {
+    ResponseDesc resp;
+    for (const auto& input : inputs) {
+        Blob::Ptr blob;
+        if (request->GetBlob(input.first.c_str(), blob, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+
+        // Measured time shouldn't depend on data much, but degenerate values may hit special fast paths
+        // (e.g. zero confidences in DetectionOutput), so floating point inputs get pseudo-random values.
+        // Integer inputs are often indices or shapes, so zero is the only value which is safe for them.
+        auto data = blob->buffer().as<uint8_t*>();
+        if (blob->getTensorDesc().getPrecision() == Precision::FP32) {
+            auto fdata = reinterpret_cast<float*>(data);
+            uint32_t seed = 1;
+            for (size_t i = 0; i < blob->size(); i++) {
+                seed = seed * 1664525u + 1013904223u;
+                fdata[i] = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24);
+            }
+        } else {
+            std::memset(data, 0, blob->byteSize());
+        }
+    }
+}
+
+void infer(const IInferRequest::Ptr& request) {
+    ResponseDesc resp;
+    if (request->StartAsync(&resp) != OK)
+        THROW_IE_EXCEPTION << resp.msg;
+    if (request->Wait(IInferRequest::WaitMode::RESULT_READY, &resp) != OK)
+        THROW_IE_EXCEPTION << resp.msg;
+}
+
+}  // namespace
+
+MKLDNNConfigTuner::MKLDNNConfigTuner(const Config& cfg) : _cfg(cfg) {}
+
+Config MKLDNNConfigTuner::withStreams(int streams, int threads) const {
+    Config candidate = _cfg;
+    candidate.streamExecutorConfig._streams = streams;
+    candidate.streamExecutorConfig._threads = threads;
+    candidate._config.clear();
+    candidate.updateProperties();
+    return candidate;
+}
+
+std::vector<Config> MKLDNNConfigTuner::getCandidates() const {
+    const int cores = getNumberOfCPUCores();
+    const int threads = _cfg.streamExecutorConfig._threads;
+
+    std::vector<Config> candidates;
+    if (_cfg.autoTune == Config::AutoTuneMode::Latency) {
+        // Single stream, try physical cores only and all logical cores
+        if (threads > 0) {
+            candidates.push_back(withStreams(1, threads));
+        } else {
+            candidates.push_back(withStreams(1, cores));
+            if (parallel_get_max_threads() != cores)
+                candidates.push_back(withStreams(1, parallel_get_max_threads()));
+        }
+    } else {
+        // Every candidate costs a network load and a measurement, so only a few stream counts are tried:
+        // powers of two, a stream per NUMA node and a stream per core. Every stream gets a part of all threads.
+        std::set<int> streamsCounts = {static_cast<int>(getAvailableNUMANodes().size()), cores};
+        for (int streams = 1; streams < cores; streams *= 2)
+            streamsCounts.insert(streams);
+        for (int streams : streamsCounts) {
+            if (streams > 0 && streams <= cores)
+                candidates.push_back(withStreams(streams, threads));
+        }
+    }
+    return candidates;
+}
+
+MKLDNNConfigTuner::Measurement MKLDNNConfigTuner::measure(const MKLDNNExecNetwork::Ptr& execNetwork,
+                                                          const ICNNNetwork& network, int nireq) const {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+
+    std::vector<IInferRequest::Ptr> requests(nireq);
+    for (auto& request : requests) {
+        execNetwork->CreateInferRequest(request);
+        fillInputs(request, inputs);
+        // warm-up
+        infer(request);
+    }
+
+    std::vector<std::vector<double>> latencies(nireq);
+    const auto start = Time::now();
+    const auto deadline = start + std::chrono::milliseconds(_cfg.autoTuneTime);
+    std::vector<std::thread> threads;
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    for (int i = 0; i < nireq; i++) {
+        threads.emplace_back([&, i] {
+            try {
+                do {
+                    const auto inferStart = Time::now();
+                    infer(requests[i]);
+                    latencies[i].push_back(std::chrono::duration<double, std::milli>(Time::now() - inferStart).count());
+                } while (Time::now() < deadline);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                error = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+
+    const double elapsed = std::chrono::duration<double>(Time::now() - start).count();
+    std::vector<double> all;
+    for (const auto& requestLatencies : latencies)
+        all.insert(all.end(), requestLatencies.begin(), requestLatencies.end());
+    std::sort(all.begin(), all.end());
+
+    Measurement result;
+    result.fps = all.size() / elapsed;
+    result.medianLatency = all[all.size() / 2];
+    result.p90Latency = all[all.size() * 9 / 10];
+    return result;
+}
+
+bool MKLDNNConfigTuner::isBetter(const Measurement& lhs, const Measurement& rhs) const {
+    if (_cfg.autoTune == Config::AutoTuneMode::Latency)
+        return lhs.medianLatency < rhs.medianLatency;
+
+    if (_cfg.autoTuneLatencySLA > 0.f) {
+        const bool lhsFits = lhs.p90Latency <= _cfg.autoTuneLatencySLA;
+        const bool rhsFits = rhs.p90Latency <= _cfg.autoTuneLatencySLA;
+        if (lhsFits != rhsFits)
+            return lhsFits;
+        // If nothing fits the limit, the closest configuration is used
+        if (!lhsFits)
+            return lhs.p90Latency < rhs.p90Latency;
+    }
+    return lhs.fps > rhs.fps;
+}
+
+std::string MKLDNNConfigTuner::getKey(const ICNNNetwork& network) const {
+    // Performance depends on topology and shapes, values of weights are not taken into account
+    std::ostringstream model;
+    for (const auto& layer : CNNNetSortTopologically(network)) {
+        model << layer->type << ":" << layer->precision.name();
+        for (const auto& data : layer->outData) {
+            model << "[";
+            for (auto dim : data->getTensorDesc().getDims())
+                model << dim << ",";
+            model << data->getTensorDesc().getPrecision().name() << "]";
+        }
+        model << ";";
+    }
+    const std::string modelStr = model.str();
+    const uint64_t modelHash = MKLDNNWeightsSharing::GetHashFunc().hash(
+            reinterpret_cast<const unsigned char*>(modelStr.data()), modelStr.size());
+
+    std::ostringstream key;
+    key << modelHash
+        << "_" << std::thread::hardware_concurrency() << "_" << getNumberOfCPUCores()
+        << "_" << getAvailableNUMANodes().size()
+        << "_" << with_cpu_x86_avx2() << with_cpu_x86_avx512_core() << with_cpu_x86_bfloat16()
+        << "_" << static_cast<int>(_cfg.autoTune) << "_" << _cfg.autoTuneLatencySLA
+        << "_" << _cfg.streamExecutorConfig._threads << "_" << static_cast<int>(_cfg.streamExecutorConfig._threadBindingType)
+        << "_" << _cfg.enforceBF16;
+    return key.str();
+}
+
+/*
+ * Cache file contains one line per tuned model: <key> <streams> <threads>
+ */
+bool MKLDNNConfigTuner::loadResult(const std::string& key, Config& result) const {
+    if (_cfg.autoTuneCache.empty())
+        return false;
+
+    std::ifstream file(_cfg.autoTuneCache);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream entry(line);
+        std::string entryKey;
+        int streams = 0, threads = 0;
+        if ((entry >> entryKey >> streams >> threads) && entryKey == key && streams > 0) {
+            result = withStreams(streams, threads);
+            return true;
+        }
+    }
+    return false;
+}
+
+void MKLDNNConfigTuner::saveResult(const std::string& key, const Config& result) const {
+    if (_cfg.autoTuneCache.empty())
+        return;
+
+    std::map<std::string, std::string> entries;
+    {
+        std::ifstream file(_cfg.autoTuneCache);
+        std::string line;
+        while (std::getline(file, line)) {
+            auto pos = line.find(' ');
+            if (pos != std::string::npos)
+                entries[line.substr(0, pos)] = line.substr(pos + 1);
+        }
+    }
+    entries[key] = std::to_string(result.streamExecutorConfig._streams) + " " +
+                   std::to_string(result.streamExecutorConfig._threads);
+
+    // Replace the file at once, so concurrent readers see either old or new content
+    const std::string tmpPath = _cfg.autoTuneCache + ".tmp";
+    {
+        std::ofstream file(tmpPath);
+        if (!file)
+            return;
+        for (const auto& entry : entries)
+            file << entry.first << " " << entry.second << "\n";
+    }
+    if (std::rename(tmpPath.c_str(), _cfg.autoTuneCache.c_str()) != 0) {
+        // rename doesn't replace existing files on Windows
+        std::remove(_cfg.autoTuneCache.c_str());
+        std::rename(tmpPath.c_str(), _cfg.autoTuneCache.c_str());
+    }
+}
+
+Config MKLDNNConfigTuner::tune(const ICNNNetwork& network, const LoadFunc& load) const {
+    const std::string key = getKey(network);
+
+    Config best;
+    if (loadResult(key, best))
+        return best;
+
+    best = _cfg;
+    Measurement bestMeasurement;
+    bool found = false;
+    for (const auto& candidate : getCandidates()) {
+        // Candidates get executors of their own, which are not reused by other networks and are released
+        // as soon as the candidate is measured. Otherwise the manager keeps idle threads of every candidate.
+        Config tuningCandidate = candidate;
+        tuningCandidate.streamExecutorConfig._name = tuningExecutorName;
+
+        // One request per stream for throughput, latency is measured without concurrent requests
+        const int nireq = _cfg.autoTune == Config::AutoTuneMode::Latency ? 1 : candidate.streamExecutorConfig._streams;
+        const auto measurement = measure(load(tuningCandidate), network, nireq);
+        ExecutorManager::getInstance()->clear(tuningExecutorName);
+        if (!found || isBetter(measurement, bestMeasurement)) {
+            best = candidate;
+            bestMeasurement = measurement;
+            found = true;
+        }
+    }
+
+    if (found)
+        saveResult(key, best);
+    return best;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_exec_network.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Selects streams and threads configuration for a network by loading it with a set of candidate
+ * configurations and measuring throughput and latency of each of them.
+ * The selected configuration is persisted per model and machine if CPU_AUTO_TUNE_CACHE is set.
+ */
+class MKLDNNConfigTuner {
+public:
+    using LoadFunc = std::function<MKLDNNExecNetwork::Ptr(const Config&)>;
+
+    explicit MKLDNNConfigTuner(const Config& cfg);
+
+    /**
+     * Returns the base configuration with streams and threads settings replaced by the best found ones
+     * @param network Network to tune for
+     * @param load Creates an executable network for a candidate configuration
+     */
+    Config tune(const InferenceEngine::ICNNNetwork& network, const LoadFunc& load) const;
+
+private:
+    struct Measurement {
+        double fps = 0.0;
+        double medianLatency = 0.0;
+        double p90Latency = 0.0;
+    };
+
+    std::vector<Config> getCandidates() const;
+    Measurement measure(const MKLDNNExecNetwork::Ptr& execNetwork, const InferenceEngine::ICNNNetwork& network,
+                        int nireq) const;
+    bool isBetter(const Measurement& lhs, const Measurement& rhs) const;
+
+    std::string getKey(const InferenceEngine::ICNNNetwork& network) const;
+    bool loadResult(const std::string& key, Config& result) const;
+    void saveResult(const std::string& key, const Config& result) const;
+
+    Config withStreams(int streams, int threads) const;
+
+    Config _cfg;
+};
+
+}  // namespace MKLDNNPlugin
@@ -23,6 +23,7 @@
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
+#include <future>
 #include <unordered_set>
 #include <utility>
 
@@ -123,12 +124,21 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                                 ? std::max(1, threads/streamExecutorConfig._streams)
                                                 : threads;
-        streamExecutorConfig._name = "CPUStreamsExecutor";
+        if (cfg.lowLatency) {
+            // covers gaps between back to back requests of a latency bound application
+            streamExecutorConfig._spinWaitTime = 200;
+        }
         _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+        // With several streams pre-processing of a request already overlaps inference of requests on other streams,
+        // so it stays in the stream. The only stream gets a pre-processing thread to run ahead of it.
+        if (1 == cfg.streamExecutorConfig._streams) {
+            _preprocessExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+                IStreamsExecutor::Config{"CPUPreprocessExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+        }
     } else {
         _callbackExecutor = _taskExecutor;
     }
@@ -147,12 +157,30 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         if (nullptr != streamExecutor) {
             numaNode = streamExecutor->GetNumaNodeId();
         }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
+        auto weightsCache = numaNodesWeights.get(numaNode, graph->getProperty().weightsCacheDir);
+        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, weightsCache);
         return graph;
     }};
 
     _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
 
+    auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+    if (cfg.lowLatency && !cfg.exclusiveAsyncRequests && nullptr != streamsExecutor) {
+        // Requests are pinned to streams, so they need graphs of particular streams
+        _streamGraphs.resize(cfg.streamExecutorConfig._streams);
+        std::vector<std::future<void>> futures;
+        for (int streamIndex = 0; streamIndex < static_cast<int>(_streamGraphs.size()); streamIndex++) {
+            auto task = std::make_shared<std::packaged_task<void()>>([this, streamIndex] {
+                _streamGraphs[streamIndex] = _graphs.local().get();
+            });
+            futures.emplace_back(task->get_future());
+            streamsExecutor->run([task] { (*task)(); }, streamIndex);
+        }
+        for (auto&& future : futures) {
+            future.get();
+        }
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -186,7 +214,8 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor,
+                                                                      _preprocessExecutor);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -226,6 +255,7 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(MEMORY_USAGE));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -240,11 +270,67 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(MEMORY_USAGE)) {
+        std::unordered_map<const void*, size_t> countedWeights;
+        result = IE_SET_METRIC(MEMORY_USAGE, GetMemoryUsage(countedWeights));
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+std::map<std::string, uint64_t> MKLDNNExecNetwork::GetMemoryUsage(std::unordered_map<const void*, size_t>& countedWeights) const {
+    std::map<std::string, uint64_t> usage;
+    uint64_t weights = 0, activations = 0, constants = 0, requests = 0;
+
+    // streams on the same NUMA node share weights, so they are collected by pointer first
+    std::unordered_map<const void*, size_t> graphsWeights;
+    int streamId = 0;
+    for (auto&& graph : _graphs) {
+        const auto prefix = "stream" + std::to_string(streamId++) + ".";
+        usage[prefix + "activations"] = graph->GetActivationsMemorySize();
+        usage[prefix + "constants"] = graph->GetConstantsMemorySize();
+        activations += graph->GetActivationsMemorySize();
+        constants += graph->GetConstantsMemorySize();
+        graph->GetWeightsMemory(graphsWeights);
+    }
+    for (auto&& blob : graphsWeights) {
+        if (countedWeights.insert(blob).second)
+            weights += blob.second;
+    }
+
+    // the cloned network keeps original weights of its layers, they may be shared with other networks
+    uint64_t networkWeights = 0;
+    if (_clonedNetwork) {
+        for (auto&& layer : _clonedNetwork->allLayers()) {
+            for (auto&& blob : layer.second->blobs) {
+                if (!blob.second)
+                    continue;
+                const void* data = blob.second->cbuffer().as<const void*>();
+                if (data != nullptr && countedWeights.emplace(data, blob.second->byteSize()).second)
+                    networkWeights += blob.second->byteSize();
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{_requestsMutex};
+        for (size_t i = 0; i < _requests.size(); i++) {
+            const auto prefix = "request" + std::to_string(i) + ".";
+            usage[prefix + "io"] = _requests[i]->GetIOMemorySize();
+            usage[prefix + "converted_inputs"] = _requests[i]->GetConvertedInputsMemorySize();
+            requests += _requests[i]->GetIOMemorySize() + _requests[i]->GetConvertedInputsMemorySize();
+        }
+    }
+
+    usage["weights"] = weights;
+    usage["network_weights"] = networkWeights;
+    usage["activations"] = activations;
+    usage["constants"] = constants;
+    usage["requests"] = requests;
+    usage["total"] = weights + networkWeights + activations + constants + requests;
+    return usage;
+}
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const {
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
@@ -16,9 +16,12 @@
 #include <string>
 #include <cnn_network_impl.hpp>
 #include <unordered_map>
+#include <mutex>
 
 namespace MKLDNNPlugin {
 
+class MKLDNNInferRequest;
+
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
@@ -44,6 +47,15 @@ public:
 
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    /**
+     * @brief Returns bytes used by the network: "weights", "network_weights", "activations", "constants", "requests" and "total",
+     * with a breakdown per stream ("stream<N>.activations", "stream<N>.constants") and per infer request
+     * ("request<N>.io", "request<N>.converted_inputs").
+     * "weights" are prepacked weights of the graph nodes, "network_weights" are weight blobs of the layers of the cloned network.
+     * Weights found in countedWeights are shared with other networks and are not counted again.
+     */
+    std::map<std::string, uint64_t> GetMemoryUsage(std::unordered_map<const void*, size_t>& countedWeights) const;
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
@@ -55,6 +67,13 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // Runs input pre-processing ahead of the only stream, null with several streams
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessExecutor;
+    // Graphs of the streams indexed by stream, filled in low latency mode only when requests are pinned to streams
+    std::vector<MKLDNNGraph*>                   _streamGraphs;
+    std::atomic<unsigned int>                   _nextStreamIndex = {0};
+    mutable std::mutex                          _requestsMutex;
+    std::vector<MKLDNNInferRequest*>            _requests;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
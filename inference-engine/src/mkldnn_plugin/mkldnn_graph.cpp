@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <thread>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -21,6 +22,7 @@
 #include "mkldnn_memory_solver.hpp"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 
 #include <graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -88,8 +90,11 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // Hashing and caching of weights pays off only if somebody else may use them: graphs of other streams,
+    // other networks loaded by the plugin or other processes through the file-backed store
+    const bool canShareWeights = config.streamExecutorConfig._streams != 1 || config.shareWeightsAcrossNetworks ||
+                                 !config.weightsCacheDir.empty();
+    weightsCache = canShareWeights ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -344,6 +349,9 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.optimizeLayouts)
+        OptimizeLayouts();
+
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
     }
@@ -438,6 +446,114 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+void MKLDNNGraph::OptimizeLayouts() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::OptimizeLayouts)
+    // Greedy selection in InitDescriptors() takes into account parent edges only, so a node may pick
+    // a layout which matches its producer but conflicts with all its consumers. Here the selection is
+    // refined for the whole graph: every node takes the descriptor with the lowest sum of reorder
+    // traffic on all its edges and of the penalty for a less preferable implementation type.
+    // Sweeps are repeated until the selection is stable, each change strictly decreases the total cost.
+    const int maxSweeps = 4;
+    // Cost of one step down in the priority list measured in "full passes over the output tensor"
+    const int64_t implRankPenalty = 2;
+
+    auto isAdjustable = [](const MKLDNNNodePtr &node) {
+        switch (node->getType()) {
+            case Input:
+            case Output:
+            case Reorder:
+            case Concatenation:
+            case Split:
+            case MemoryInput:
+            case MemoryOutput:
+                return false;
+            default:
+                return node->getSupportedPrimitiveDescriptors().size() > 1 &&
+                       node->getSelectedPrimitiveDescriptor() != nullptr;
+        }
+    };
+
+    auto implRank = [](const std::vector<impl_desc_type> &priority, impl_desc_type type) -> int64_t {
+        auto it = std::find(priority.begin(), priority.end(), type);
+        return std::distance(priority.begin(), it);
+    };
+
+    auto descCost = [&](const MKLDNNNodePtr &node, const PrimitiveDescInfo &pd, int64_t rankPenalty) -> int64_t {
+        const auto &pdConfig = pd.getConfig();
+        if (pdConfig.inConfs.size() > node->getParentEdges().size())
+            return std::numeric_limits<int64_t>::max();
+
+        int64_t cost = 0;
+        for (size_t j = 0; j < pdConfig.inConfs.size(); j++) {
+            auto parentEdge = node->getParentEdgeAt(j);
+            auto parent_spd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+            if (parent_spd == nullptr || parent_spd->getConfig().outConfs.empty())
+                continue;
+
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= parent_spd->getConfig().outConfs.size())
+                inNum = 0;
+            if (!MKLDNNExtensionUtils::initTensorsAreEqual(pdConfig.inConfs[j].desc,
+                                                           parent_spd->getConfig().outConfs[inNum].desc))
+                cost += parentEdge->getDims().size();
+        }
+
+        int64_t outSize = 0;
+        for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+            auto childEdge = node->getChildEdgeAt(j);
+            outSize = std::max<int64_t>(outSize, childEdge->getDims().size());
+
+            auto child_spd = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+            int inNum = childEdge->getInputNum();
+            int outNum = childEdge->getOutputNum();
+            if (child_spd == nullptr || pdConfig.outConfs.empty() ||
+                    outNum < 0 || outNum >= child_spd->getConfig().inConfs.size())
+                continue;
+            if (inNum < 0 || inNum >= pdConfig.outConfs.size())
+                inNum = 0;
+            if (!MKLDNNExtensionUtils::initTensorsAreEqual(pdConfig.outConfs[inNum].desc,
+                                                           child_spd->getConfig().inConfs[outNum].desc))
+                cost += childEdge->getDims().size();
+        }
+
+        return cost + rankPenalty * implRankPenalty * outSize;
+    };
+
+    for (int sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (auto &node : graphNodes) {
+            if (!isAdjustable(node))
+                continue;
+
+            const auto &priority = node->getPrimitivesPriority();
+            const auto &supported = node->getSupportedPrimitiveDescriptors();
+
+            int64_t bestRank = std::numeric_limits<int64_t>::max();
+            for (const auto &pd : supported)
+                bestRank = std::min(bestRank, implRank(priority, pd.getImplementationType()));
+
+            int selected = node->selectedPrimitiveDescriptorIndex;
+            int64_t selectedCost = descCost(node, supported[selected],
+                                            implRank(priority, supported[selected].getImplementationType()) - bestRank);
+            for (int i = 0; i < supported.size(); i++) {
+                if (i == node->selectedPrimitiveDescriptorIndex)
+                    continue;
+                int64_t cost = descCost(node, supported[i], implRank(priority, supported[i].getImplementationType()) - bestRank);
+                if (cost < selectedCost) {
+                    selectedCost = cost;
+                    selected = i;
+                }
+            }
+
+            if (selected != node->selectedPrimitiveDescriptorIndex) {
+                node->selectPrimitiveDescriptorByIndex(selected);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
 void MKLDNNGraph::InitEdges() {
     auto reorderArgs = [](const InferenceEngine::TensorDesc &parentDesc, const InferenceEngine::TensorDesc &childDesc) {
         std::string inArgs, outArgs;
@@ -591,9 +707,69 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
+    // Keep the state of MemoryOutput -> MemoryInput pairs in place. If all consumers of the state read it before
+    // the new state is produced, the producer may write the new state directly into the state storage, so
+    // MemoryOutput doesn't need to copy it between infer calls. Such clasters are merged into one allocation.
+    std::vector<MKLDNNEdgePtr> inPlaceStates;
+#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    auto findClaster = [&](const MKLDNNEdgePtr &edge) -> int {
+        for (int i = 0; i < edge_clasters.size(); i++)
+            if (std::find(edge_clasters[i].begin(), edge_clasters[i].end(), edge) != edge_clasters[i].end())
+                return i;
+        return -1;
+    };
+
+    for (auto &node : graphNodes) {
+        auto memOutput = dynamic_cast<MKLDNNMemoryOutputNode *>(node.get());
+        if (node->getType() != MemoryOutput || !memOutput)
+            continue;
+
+        MKLDNNNodePtr memInput;
+        for (auto &candidate : graphNodes) {
+            auto candidateMemInput = dynamic_cast<MKLDNNMemoryInputNode *>(candidate.get());
+            if (candidate->getType() == MemoryInput && candidateMemInput &&
+                    candidateMemInput->getId() == memOutput->getId()) {
+                memInput = candidate;
+                break;
+            }
+        }
+        if (!memInput || memInput->getChildEdges().empty())
+            continue;
+
+        auto srcEdge = node->getParentEdgeAt(0);
+        auto dstEdge = memInput->getChildEdgeAt(0);
+        if (srcEdge->getDesc() != dstEdge->getDesc())
+            continue;
+
+        int srcIdx = findClaster(srcEdge);
+        int dstIdx = findClaster(dstEdge);
+        if (srcIdx < 0 || dstIdx < 0 || srcIdx == dstIdx)
+            continue;
+
+        int lastRead = -1;
+        for (auto &edge : edge_clasters[dstIdx])
+            lastRead = std::max(lastRead, edge->getChild()->execIndex);
+
+        bool canBeInPlace = true;
+        for (auto &edge : edge_clasters[srcIdx]) {
+            canBeInPlace &= edge->getParent()->execIndex > lastRead &&
+                            edge->getParent()->getType() != Input &&
+                            edge->getChild()->getType() != Output &&
+                            !isConstOutput(edge);
+        }
+        if (!canBeInPlace)
+            continue;
+
+        edge_clasters[dstIdx].insert(edge_clasters[dstIdx].end(), edge_clasters[srcIdx].begin(), edge_clasters[srcIdx].end());
+        edge_clasters.erase(edge_clasters.begin() + srcIdx);
+        inPlaceStates.push_back(dstEdge);
+    }
+#endif
+
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    std::vector<bool> isConstClaster(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
@@ -636,6 +812,7 @@ void MKLDNNGraph::AllocateWithReuse() {
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
         }
+        isConstClaster[i] = isConst;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -653,6 +830,14 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
+    // Boxes of constant data live during the whole execution, so they never share memory with others
+    constantsMemSize = 0;
+    for (int i = 0; i < boxes.size(); i++) {
+        if (isConstClaster[i])
+            constantsMemSize += static_cast<size_t>(boxes[i].size) * alignment;
+    }
+    activationsMemSize = total_size - constantsMemSize;
+
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
@@ -675,7 +860,10 @@ void MKLDNNGraph::AllocateWithReuse() {
                 count++;
             }
         }
-        IE_ASSERT(count == 1);
+        bool isInPlaceState = std::any_of(inPlaceStates.begin(), inPlaceStates.end(), [&](const MKLDNNEdgePtr &edge) {
+            return std::find(edge_clasters[i].begin(), edge_clasters[i].end(), edge) != edge_clasters[i].end();
+        });
+        IE_ASSERT(count == 1 || (isInPlaceState && count > 1));
     }
 }
 
@@ -784,9 +972,22 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    if (config.collectHwCounters) {
+        if (!hwCounters) {
+            // Any thread of the process may join the arena, so there is room for all of them and the calling thread
+            const auto maxThreads = std::max<std::size_t>(parallel_get_max_threads(), std::thread::hardware_concurrency()) + 1;
+            hwCounters = std::make_shared<HwCounters>(maxThreads);
+            // Primitives are executed by the calling thread and the threads of its parallel regions
+            hwCounters->addCurrentStreamThreads();
+        } else {
+            // The graph may be inferred from another thread, the check is lock-free if it has already joined
+            hwCounters->addCurrentThread();
+        }
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+        PERF_HW(graphNodes[i], hwCounters.get());
 
         if (batch > 0)
             graphNodes[i]->setDynamicBatchLim(batch);
@@ -917,7 +1118,25 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         getPerfMapFor(perfMap, graphNodes[i]);
     }
 
-    if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
+    if (!config.dumpToDot.empty()) {
+        dumpToDotFile(config.dumpToDot + "_perf.dot");
+        dumpReordersReport(config.dumpToDot + "_reorders.csv");
+    }
+}
+
+void MKLDNNGraph::GetWeightsMemory(std::unordered_map<const void*, size_t>& weights) const {
+    std::function<void(const MKLDNNNodePtr&)> addNodeWeights = [&](const MKLDNNNodePtr& node) {
+        for (const auto& memory : node->internalBlobMemory) {
+            if (memory)
+                weights[memory->GetData()] = memory->GetSize();
+        }
+        // post operations keep their weights in fused nodes
+        for (const auto& fusedNode : node->fusedWith)
+            addNodeWeights(fusedNode);
+    };
+
+    for (const auto& node : graphNodes)
+        addNodeWeights(node);
 }
 
 void MKLDNNGraph::setConfig(const Config &cfg) {
@@ -1109,6 +1328,40 @@ void MKLDNNGraph::dumpToDotFile(std::string file) const {
     dot.close();
 }
 
+void MKLDNNGraph::dumpReordersReport(std::string file) const {
+    std::ofstream report;
+    report.open(file);
+    if (!report.is_open()) THROW_IE_EXCEPTION << "CPU Plugin cannot create reorders report file " << file << ".";
+
+    auto formatName = [](const TensorDesc &desc) {
+        return std::string(desc.getPrecision().name()) + "/" +
+               MKLDNNMemory::formatToString(MKLDNNMemoryDesc(desc).getFormat());
+    };
+
+    size_t count = 0;
+    uint64_t totalTime = 0;
+    report << "name;parent;child;src;dst;elements;avg_uSec" << std::endl;
+    for (auto &node : graphNodes) {
+        if (node->getType() != Reorder)
+            continue;
+
+        auto parentEdge = node->getParentEdgeAt(0);
+        auto childEdge = node->getChildEdgeAt(0);
+        uint64_t time = node->PerfCounter().avg();
+        report << node->getName() << ";"
+               << parentEdge->getParent()->getName() << ";"
+               << childEdge->getChild()->getName() << ";"
+               << formatName(parentEdge->getDesc()) << ";"
+               << formatName(childEdge->getDesc()) << ";"
+               << parentEdge->getDims().size() << ";"
+               << time << std::endl;
+        count++;
+        totalTime += time;
+    }
+    report << "total;" << count << ";;;;;" << totalTime << std::endl;
+    report.close();
+}
+
 void MKLDNNGraph::do_before(const std::string &dir, const MKLDNNNodePtr &node) {
     auto exec_order = std::to_string(node->execIndex);
     std::string nodeName = node->name;
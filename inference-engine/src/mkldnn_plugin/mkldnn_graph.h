@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 namespace MKLDNNPlugin {
 
@@ -78,6 +79,26 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Returns size of the part of memory workspace which is reused between intermediate tensors
+     */
+    size_t GetActivationsMemorySize() const {
+        return activationsMemSize;
+    }
+
+    /**
+     * @brief Returns size of the part of memory workspace which keeps constant data and memory states during the whole execution
+     */
+    size_t GetConstantsMemorySize() const {
+        return constantsMemSize;
+    }
+
+    /**
+     * @brief Adds prepacked weights of the nodes to @p weights. Data pointer is used as the key,
+     * so weights shared between graphs through the weights cache are counted once.
+     */
+    void GetWeightsMemory(std::unordered_map<const void*, size_t>& weights) const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -115,6 +136,11 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    size_t activationsMemSize = 0;
+    size_t constantsMemSize = 0;
+
+    // Hardware counters of threads executing the graph, created only if they are requested by config
+    HwCounters::Ptr hwCounters;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -131,6 +157,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void OptimizeLayouts();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
@@ -146,6 +173,7 @@ protected:
 
 private:
     void dumpToDotFile(std::string file) const;
+    void dumpReordersReport(std::string file) const;
     struct ParsedLayer {
         MKLDNNNodePtr parent;
         InferenceEngine::CNNLayerPtr cnnLayer;
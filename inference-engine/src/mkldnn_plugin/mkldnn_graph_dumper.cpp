@@ -15,6 +15,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <sstream>
+#include <iomanip>
 
 using namespace InferenceEngine;
 
@@ -265,6 +267,25 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    const auto avgNs = node->PerfCounter().avgNs();
+    if (avgNs > 0) {
+        auto toString = [](double value) {
+            std::ostringstream stream;
+            stream << std::fixed << std::setprecision(3) << value;
+            return stream.str();
+        };
+        // operations and bytes per nanosecond are the same as GFLOPS and GB/s
+        serialization_info[ExecGraphInfoSerialization::ESTIMATED_GFLOPS] = toString(node->estimateFlops() / avgNs);
+        serialization_info[ExecGraphInfoSerialization::ESTIMATED_GBPS] = toString(node->estimateMemoryTraffic() / avgNs);
+    }
+
+    const auto hw = node->PerfCounter().avgHw();
+    if (hw.cycles != 0) {
+        serialization_info[ExecGraphInfoSerialization::HW_CYCLES] = std::to_string(hw.cycles);
+        serialization_info[ExecGraphInfoSerialization::HW_INSTRUCTIONS] = std::to_string(hw.instructions);
+        serialization_info[ExecGraphInfoSerialization::HW_LLC_MISSES] = std::to_string(hw.llcMisses);
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     return serialization_info;
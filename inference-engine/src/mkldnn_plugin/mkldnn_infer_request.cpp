@@ -7,6 +7,8 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <algorithm>
+#include <mutex>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -24,7 +26,13 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
-    graph = execNetwork->_graphs.begin()->get();
+    if (!execNetwork->_streamGraphs.empty()) {
+        // Requests are distributed between streams in round robin order
+        streamIndex = static_cast<int>(execNetwork->_nextStreamIndex++ % execNetwork->_streamGraphs.size());
+        graph = execNetwork->_streamGraphs[streamIndex];
+    } else {
+        graph = execNetwork->_graphs.begin()->get();
+    }
     for (const auto& it : _networkInputs) {
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
@@ -34,10 +42,37 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
     }
+
+    std::lock_guard<std::mutex> lock{execNetwork->_requestsMutex};
+    execNetwork->_requests.push_back(this);
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
+
+    std::lock_guard<std::mutex> lock{execNetwork->_requestsMutex};
+    auto& requests = execNetwork->_requests;
+    requests.erase(std::remove(requests.begin(), requests.end(), this), requests.end());
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::updateMemoryUsage() {
+    size_t ioSize = 0;
+    for (const auto& input : _inputs) {
+        if (input.second)
+            ioSize += input.second->byteSize();
+    }
+    for (const auto& output : _outputs) {
+        if (output.second)
+            ioSize += output.second->byteSize();
+    }
+    ioMemSize = ioSize;
+
+    size_t convertedSize = 0;
+    for (const auto& input : convertedInputs) {
+        if (input.second)
+            convertedSize += input.second->byteSize();
+    }
+    convertedInputsMemSize = convertedSize;
 }
 
 template <typename T>
@@ -78,25 +113,92 @@ void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
 }  // namespace
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    PreprocessInputs();
+    InferGraph();
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::isConvertedToFP32(const std::string& inputName,
+                                                         InferenceEngine::Precision precision) const {
+    switch (precision) {
+        case InferenceEngine::Precision::U16:
+            // U16 is unsupported by mkldnn
+            return true;
+        case InferenceEngine::Precision::I16:
+        case InferenceEngine::Precision::U8:
+        case InferenceEngine::Precision::BOOL:
+            // If a mean image exists, the blob is sent as FP32, otherwise it is sent directly
+            return graph->hasMeanImageFor(inputName);
+        default:
+            return false;
+    }
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::NeedsPreprocessing() const {
+    if (!_preProcData.empty())
+        return true;
+    for (const auto& input : _inputs) {
+        if (isConvertedToFP32(input.first, input.second->getTensorDesc().getPrecision()))
+            return true;
+    }
+    return false;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PreprocessInputs() {
+    execDataPreprocessing(_inputs);
+
+    for (auto& input : _inputs) {
+        if (!_networkInputs[input.first]) {
+            THROW_IE_EXCEPTION <<
+                                "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
+                                << input.first;
+        }
+
+        const auto& desc = input.second->getTensorDesc();
+        if (!isConvertedToFP32(input.first, desc.getPrecision()))
+            continue;
+
+        // Converted blob is owned by the request, so the graph input memory is touched only by InferGraph()
+        auto& iconv = convertedInputs[input.first];
+        if (!iconv || iconv->getTensorDesc().getDims() != desc.getDims() ||
+                iconv->getTensorDesc().getLayout() != desc.getLayout()) {
+            iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()});
+            iconv->allocate();
+        }
+        auto in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
+        if (in_f == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get TBlob";
+
+        switch (desc.getPrecision()) {
+            case InferenceEngine::Precision::U16:
+                copyToFloat<uint16_t>(in_f->data(), input.second.get());
+                break;
+            case InferenceEngine::Precision::I16:
+                copyToFloat<int16_t>(in_f->data(), input.second.get());
+                break;
+            default:
+                copyToFloat<uint8_t>(in_f->data(), input.second.get());
+                break;
+        }
+    }
+
+    updateMemoryUsage();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferGraph() {
     IE_PROFILING_AUTO_SCOPE_TASK(profilingTask)
-    graph = execNetwork->_graphs.local().get();
+    if (streamIndex < 0)
+        graph = execNetwork->_graphs.local().get();
     {
-        execDataPreprocessing(_inputs);
-
         changeDefaultPtr();
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
-            if (!_networkInputs[input.first]) {
-                THROW_IE_EXCEPTION <<
-                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
-                                    << input.first;
+            const auto precision = input.second->getTensorDesc().getPrecision();
+            if (isConvertedToFP32(input.first, precision)) {
+                pushInput<float>(input.first, convertedInputs.at(input.first));
+                continue;
             }
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
-            switch (input.second->getTensorDesc().getPrecision()) {
+            switch (precision) {
                 case InferenceEngine::Precision::FP32:
                     pushInput<float>(input.first, input.second);
                     break;
@@ -106,58 +208,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                 case InferenceEngine::Precision::I8:
                     pushInput<int8_t>(input.first, input.second);
                     break;
-                case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                        input.second->getTensorDesc().getDims(),
-                                                                        input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
-                    break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
+                    pushInput<int16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U8:
                 case InferenceEngine::Precision::BOOL:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    pushInput<uint8_t>(input.first, input.second);
                     break;
                 default:
-                    THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
+                    THROW_IE_EXCEPTION << "Unsupported input precision " << precision;
             }
         }
     }
@@ -208,6 +267,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
+        updateMemoryUsage();
         if (desc.getPrecision() == originPrecision &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
             externalPtr[name] = _inputs[name]->buffer();
@@ -227,6 +287,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
+        updateMemoryUsage();
         if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
                 !graph->getProperty().batchLimit) {
             externalPtr[name] = _outputs[name]->buffer();
@@ -324,6 +385,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         }
         _outputs[name] = data;
     }
+
+    updateMemoryUsage();
 }
 
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
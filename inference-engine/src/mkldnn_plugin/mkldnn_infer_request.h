@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <atomic>
 #include <memory>
 #include <string>
 #include <map>
@@ -25,6 +26,30 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Runs input pre-processing and converts inputs of precisions unsupported by the graph to FP32.
+     * Reads from the graph only which inputs have mean images, which is the same for graphs of all streams and
+     * doesn't change after loading, so it may run on any thread while the stream infers other requests.
+     */
+    void PreprocessInputs();
+
+    /**
+     * @brief Pushes pre-processed inputs to the graph of the current stream, infers it and pulls outputs
+     */
+    void InferGraph();
+
+    /**
+     * @brief Returns true if PreprocessInputs() has some work to do for current inputs
+     */
+    bool NeedsPreprocessing() const;
+
+    /**
+     * @brief Returns index of the stream which infers the request in low latency mode, or -1 if any stream may infer it
+     */
+    int GetStreamIndex() const {
+        return streamIndex;
+    }
+
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
     /**
@@ -43,13 +68,37 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Returns bytes of input and output blobs bound to the request, including blobs set by user.
+     * Can be called from any thread.
+     */
+    size_t GetIOMemorySize() const {
+        return ioMemSize;
+    }
+
+    /**
+     * @brief Returns bytes of FP32 copies of inputs made by PreprocessInputs(). Can be called from any thread.
+     */
+    size_t GetConvertedInputsMemorySize() const {
+        return convertedInputsMemSize;
+    }
+
 private:
+    void updateMemoryUsage();
+
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
+    bool isConvertedToFP32(const std::string& inputName, InferenceEngine::Precision precision) const;
+
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    int                                 streamIndex = -1;
     std::map<std::string, void*>        externalPtr;
+    // FP32 copies of inputs, filled by PreprocessInputs() and reused between inferences
+    InferenceEngine::BlobMap            convertedInputs;
+    std::atomic<size_t>                 ioMemSize {0};
+    std::atomic<size_t>                 convertedInputsMemSize {0};
     InferenceEngine::ProfilingTask      profilingTask;
 };
 }  // namespace MKLDNNPlugin
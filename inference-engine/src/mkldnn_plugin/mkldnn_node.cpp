@@ -11,6 +11,8 @@
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
+#include <numeric>
+#include <functional>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -441,6 +443,41 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     return str_type;
 }
 
+uint64_t MKLDNNNode::estimateFlops() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    if (!selectedPrimitiveDesc)
+        return 0;
+
+    uint64_t flops = 0;
+    for (const auto& outConf : selectedPrimitiveDesc->getConfig().outConfs) {
+        const auto& dims = outConf.desc.getDims();
+        flops += std::accumulate(dims.begin(), dims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    }
+    return flops;
+}
+
+uint64_t MKLDNNNode::estimateMemoryTraffic() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    if (!selectedPrimitiveDesc)
+        return 0;
+
+    auto descBytes = [](const InferenceEngine::TensorDesc& desc) {
+        const auto& dims = desc.getDims();
+        return std::accumulate(dims.begin(), dims.end(), uint64_t(1), std::multiplies<uint64_t>()) * desc.getPrecision().size();
+    };
+
+    uint64_t bytes = 0;
+    for (const auto& inConf : selectedPrimitiveDesc->getConfig().inConfs)
+        bytes += descBytes(inConf.desc);
+    for (const auto& outConf : selectedPrimitiveDesc->getConfig().outConfs)
+        bytes += descBytes(outConf.desc);
+    for (const auto& blobMemory : internalBlobMemory) {
+        if (blobMemory)
+            bytes += blobMemory->GetSize();
+    }
+    return bytes;
+}
+
 const MKLDNNEdgePtr MKLDNNNode::getParentEdgeAt(size_t idx) const {
     if (idx >= parentEdges.size())
         THROW_IE_EXCEPTION << "Node " << getName() << " contains less parent edges than " << idx;
@@ -767,14 +804,12 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            // Key doesn't depend on the layer name: equal weights of the same source layout prepacked
+            // to the same target layout are shared between nodes of all networks loaded by the plugin
+            const std::string data_hash = MKLDNNWeightsSharing::GetDataKey(internalBlob->buffer(),
+                    internalBlob->byteSize(), internalBlob->getTensorDesc());
 
-            ptr = weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreate(data_hash, engine, intDescs[i], create);
         } else {
             ptr = create();
         }
@@ -329,6 +329,17 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Estimates floating point operations of one execution, used to report achieved GFLOPS.
+     * By default one operation per output element is assumed.
+     */
+    virtual uint64_t estimateFlops() const;
+
+    /**
+     * @brief Estimates bytes of inputs, outputs and internal blobs accessed by one execution, used to report achieved GB/s
+     */
+    uint64_t estimateMemoryTraffic() const;
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
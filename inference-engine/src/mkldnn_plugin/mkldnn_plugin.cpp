@@ -6,12 +6,14 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_config_tuner.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
+#include <algorithm>
 #include <ie_system_conf.h>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
@@ -22,11 +24,13 @@
 #include <transformations/convert_opset2_to_opset1/convert_opset2_to_opset1.hpp>
 #include <transformations/convert_opset3_to_opset2/convert_opset3_to_opset2.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/scaled_dot_product_attention_fusion.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/op/fused/gelu.hpp>
 #include "ngraph_ops/fully_connected.hpp"
+#include "ngraph_ops/scaled_dot_product_attention_ie.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 #if defined(_WIN32) || defined(WIN32)
@@ -67,6 +71,11 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork) {
             return fc_op->input_value(0).get_shape().size() == 3ul;
         }
 
+        // Fused attention kernel computes in FP32 only, other precisions keep the original subgraph
+        if (auto sdpa_op = std::dynamic_pointer_cast<const ngraph::op::ScaledDotProductAttentionIE>(node)) {
+            return sdpa_op->get_output_element_type(0) != ::ngraph::element::f32;
+        }
+
         return std::dynamic_pointer_cast<const ::ngraph::opset2::Gelu>(node) ||
             std::dynamic_pointer_cast<const ::ngraph::opset2::BatchToSpace>(node) ||
             std::dynamic_pointer_cast<const ::ngraph::opset2::SpaceToBatch>(node);
@@ -79,6 +88,11 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork) {
     ngraph::pass::CommonOptimizations(transformations_callback).run_on_function(nGraphFunc);
     ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
     ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
+
+    auto attention_fusion = ngraph::pass::ScaledDotProductAttentionFusion();
+    attention_fusion.setCallback(transformations_callback);
+    attention_fusion.run_on_function(nGraphFunc);
+
     ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
     clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
 }
@@ -112,6 +126,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    {
+        std::lock_guard<std::mutex> lock{networksMutex};
+        conf.shareWeightsAcrossNetworks = std::any_of(networks.begin(), networks.end(),
+                [](const std::weak_ptr<MKLDNNExecNetwork>& network) { return !network.expired(); });
+    }
+
     std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
     if (clonedNetwork->getFunction()) {
         Transformation(clonedNetwork);
@@ -123,7 +143,22 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         transformator.fullTrim();
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    if (conf.autoTune != Config::AutoTuneMode::Off) {
+        MKLDNNConfigTuner tuner(conf);
+        conf = tuner.tune(*clonedNetwork, [&](const Config& candidate) {
+            return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, candidate, extensionManager, weightsSharing);
+        });
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    {
+        std::lock_guard<std::mutex> lock{networksMutex};
+        networks.erase(std::remove_if(networks.begin(), networks.end(),
+                                      [](const std::weak_ptr<MKLDNNExecNetwork>& network) { return network.expired(); }),
+                       networks.end());
+        networks.push_back(execNetwork);
+    }
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -166,6 +201,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(MEMORY_USAGE));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -212,6 +248,22 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(MEMORY_USAGE)) {
+        // networks share weights through the weights cache, so the same weights are counted once
+        std::unordered_map<const void*, size_t> countedWeights;
+        std::map<std::string, uint64_t> usage = {{"total", 0}};
+        std::lock_guard<std::mutex> lock{networksMutex};
+        for (auto&& weakNetwork : networks) {
+            auto network = weakNetwork.lock();
+            if (!network)
+                continue;
+            for (auto&& category : network->GetMemoryUsage(countedWeights)) {
+                // per stream and per request values make sense only for a single network
+                if (category.first.find('.') == std::string::npos)
+                    usage[category.first] += category.second;
+            }
+        }
+        IE_SET_METRIC_RETURN(MEMORY_USAGE, usage);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -13,6 +13,7 @@
 #include <memory>
 #include <functional>
 #include <vector>
+#include <mutex>
 
 namespace MKLDNNPlugin {
 
@@ -40,6 +41,10 @@ private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
+
+    // Loaded networks for MEMORY_USAGE metric, the engine doesn't prolong their lifetime
+    mutable std::mutex networksMutex;
+    std::vector<std::weak_ptr<MKLDNNExecNetwork>> networks;
 };
 
 }  // namespace MKLDNNPlugin
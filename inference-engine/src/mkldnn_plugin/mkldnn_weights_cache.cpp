@@ -5,12 +5,160 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32) && !defined(WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+std::string MKLDNNWeightsSharing::GetDataKey(const void* data, size_t size, const InferenceEngine::TensorDesc& desc) {
+    const uint64_t data_hash = simpleCRC.hash(static_cast<const unsigned char*>(data), size);
+    std::ostringstream key;
+    key << data_hash << "_" << size << "_" << desc.getPrecision().name() << "_" << desc.getLayout();
+    for (auto dim : desc.getDims())
+        key << "_" << dim;
+
+    const auto& blk = desc.getBlockingDesc();
+    key << "_" << blk.getOffsetPadding();
+    for (size_t i = 0; i < blk.getBlockDims().size(); i++)
+        key << "_" << blk.getBlockDims()[i] << "_" << blk.getOrder()[i] << "_" << blk.getStrides()[i];
+    return key.str();
+}
+
+std::string MKLDNNWeightsSharing::GetDescKey(const mkldnn::memory::desc& desc) {
+    const auto& data = desc.data;
+    std::ostringstream key;
+    key << data.data_type << "_" << data.format;
+    for (int i = 0; i < data.ndims; i++)
+        key << "_" << data.dims[i];
+
+    // Structure of blocked layouts is not fully defined by the format tag
+    if (data.format == mkldnn_blocked) {
+        const auto& blk = data.layout_desc.blocking;
+        key << "_" << blk.offset_padding;
+        for (int i = 0; i < data.ndims; i++)
+            key << "_" << blk.block_dims[i] << "_" << blk.strides[0][i] << "_" << blk.strides[1][i]
+                << "_" << blk.padding_dims[i] << "_" << blk.offset_padding_to_data[i];
+    }
+    return key.str();
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& data_hash, const mkldnn::engine& eng,
+                                                   const mkldnn::memory::desc& desc,
+                                                   std::function<MKLDNNMemoryPtr(void)> create) {
+    const std::string key = data_hash + "_" + GetDescKey(desc);
+
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+
+    MKLDNNMemoryPtr ptr;
+    if (found != sharedWeights.end() && (ptr = found->second.lock()))
+        return ptr;
+
+    // Winograd and packed RNN weights have opaque layout which is not described by the descriptor alone
+    const bool storable = !storeDir.empty() &&
+                          desc.data.format != mkldnn_wino_fmt && desc.data.format != mkldnn_rnn_packed;
+    if (storable) {
+        const std::string path = storeDir + "/" +
+                std::to_string(simpleCRC.hash(reinterpret_cast<const unsigned char*>(key.data()), key.size())) + ".blob";
+        ptr = loadFromStore(path, key, eng, desc);
+        if (!ptr) {
+            auto created = create();
+            saveToStore(path, key, *created);
+            // Switch to the mapped copy to let other processes share its pages
+            ptr = loadFromStore(path, key, eng, desc);
+            if (!ptr)
+                ptr = created;
+        }
+    } else {
+        ptr = create();
+    }
+    sharedWeights[key] = ptr;
+    return ptr;
+}
+
+#if !defined(_WIN32) && !defined(WIN32)
+
+/*
+ * File layout of the store entry: raw prepacked memory followed by the full cache key.
+ * The key is verified on load to protect from collisions of file names.
+ */
+MKLDNNMemoryPtr MKLDNNWeightsSharing::loadFromStore(const std::string& path, const std::string& key,
+                                                    const mkldnn::engine& eng, const mkldnn::memory::desc& desc) const {
+    const size_t size = mkldnn::memory::primitive_desc(desc, eng).get_size();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    std::vector<char> stored_key(key.size());
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != size + key.size() ||
+        pread(fd, stored_key.data(), key.size(), static_cast<off_t>(size)) != static_cast<ssize_t>(key.size()) ||
+        key.compare(0, key.size(), stored_key.data(), stored_key.size()) != 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    // Private writable mapping: pages stay shared between processes until somebody writes to them
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return nullptr;
+
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng), [addr, size](MKLDNNMemory* memory) {
+        delete memory;
+        munmap(addr, size);
+    });
+    ptr->Create(desc, addr, false);
+    return ptr;
+}
+
+void MKLDNNWeightsSharing::saveToStore(const std::string& path, const std::string& key, const MKLDNNMemory& memory) const {
+    const auto& prim = memory.GetPrimitive();
+    const size_t size = prim.get_primitive_desc().get_size();
+
+    // Write to a unique temporary file first, so concurrent processes never see a partial entry
+    const std::string tmp_path = path + "." + std::to_string(getpid()) + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary);
+        if (!file)
+            return;
+        file.write(static_cast<const char*>(prim.get_data_handle()), size);
+        file.write(key.data(), key.size());
+        if (!file) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.c_str());
+}
+
+#else
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::loadFromStore(const std::string&, const std::string&,
+                                                    const mkldnn::engine&, const mkldnn::memory::desc&) const {
+    return nullptr;
+}
+
+void MKLDNNWeightsSharing::saveToStore(const std::string&, const std::string&, const MKLDNNMemory&) const {}
+
+#endif
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -30,4 +178,17 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNWeightsSharing::Ptr NumaNodesWeights::get(int numa_id, const std::string& storeDir) {
+    if (storeDir.empty())
+        return (*this)[numa_id];
+    if (_cache_map.find(numa_id) == _cache_map.end())
+        THROW_IE_EXCEPTION << "Unknown numa node id " << numa_id;
+
+    std::lock_guard<std::mutex> lock(_store_guard);
+    auto& cache = _store_cache_map[std::make_pair(numa_id, storeDir)];
+    if (!cache)
+        cache = std::make_shared<MKLDNNWeightsSharing>(storeDir);
+    return cache;
+}
+
 }  // namespace MKLDNNPlugin
@@ -12,12 +12,13 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <utility>
 
-// TODO: While CPU plugin has no ease way to clone graph object we use weight
-//       caching in global Engine context to avoid tensor memory duplication.
-//       For same cases it may be switched of (like for single stream execution)
-//       When MKLDNNGraph clone function will be ready you may removed this
-//       classes at all.
+// Weights are prepacked once per content and target layout and kept in the
+// global Engine context, so graphs of all streams and all executable networks
+// loaded by the plugin (e.g. same model with different batch or stream
+// settings) share one copy. Optionally prepacked weights are spilled to a
+// file-backed store to be shared between processes on the same host.
 
 namespace MKLDNNPlugin {
 
@@ -54,6 +55,12 @@ protected:
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+
+    /**
+     * @param storeDir Directory of the file-backed store, empty string disables the store
+     */
+    explicit MKLDNNWeightsSharing(const std::string& storeDir = "") : storeDir(storeDir) {}
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
         std::unique_lock<std::mutex> lock(guard);
@@ -66,10 +73,33 @@ public:
         }
         return ptr;
     }
+
+    /**
+     * Same as above, but if the store directory is set, memory missing in the cache is looked up
+     * in the file-backed store first, and newly created memory is spilled there.
+     * @param data_hash Key of the source data, see GetDataKey
+     * @param desc Target descriptor of prepacked memory
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string& data_hash, const mkldnn::engine& eng,
+                                 const mkldnn::memory::desc& desc, std::function<MKLDNNMemoryPtr(void)> create);
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * Builds a key from content of source data and its tensor descriptor: precision, layout, dims and blocking,
+     * since the same bytes are interpreted differently depending on the source layout
+     */
+    static std::string GetDataKey(const void* data, size_t size, const InferenceEngine::TensorDesc& desc);
+    /** Builds a key from a target memory layout: data type, format and blocking structure */
+    static std::string GetDescKey(const mkldnn::memory::desc& desc);
+
 protected:
+    MKLDNNMemoryPtr loadFromStore(const std::string& path, const std::string& key, const mkldnn::engine& eng,
+                                  const mkldnn::memory::desc& desc) const;
+    void saveToStore(const std::string& path, const std::string& key, const MKLDNNMemory& memory) const;
+
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    const std::string storeDir;
     std::mutex guard;
     static const SimpleDataHash simpleCRC;
 };
@@ -86,8 +116,17 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * Returns the cache of the NUMA node which spills to the given file-backed store.
+     * Networks loaded with different store directories never share weights in memory.
+     * @param storeDir Directory of the store, empty string gives the in-process cache
+     */
+    MKLDNNWeightsSharing::Ptr get(int numa_id, const std::string& storeDir);
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    std::map<std::pair<int, std::string>, MKLDNNWeightsSharing::Ptr> _store_cache_map;
+    std::mutex _store_guard;
 };
 
 }  // namespace MKLDNNPlugin
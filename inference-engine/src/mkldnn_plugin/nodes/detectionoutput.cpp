@@ -22,6 +22,11 @@ static bool SortScorePairDescend(const std::pair<float, T>& pair1,
     return pair1.first > pair2.first;
 }
 
+static bool SortScoreIndexDescend(const std::pair<float, int>& pair1,
+                                  const std::pair<float, int>& pair2) {
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
+}
+
 class DetectionOutputImpl: public ExtLayerBase {
 public:
     explicit DetectionOutputImpl(const CNNLayer* layer) {
@@ -109,6 +114,15 @@ public:
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
             _num_priors_actual->allocate();
 
+            InferenceEngine::SizeVector candidates_size{static_cast<size_t>(_num), static_cast<size_t>(_num_priors)};
+            _candidates = InferenceEngine::make_shared_blob<int>({Precision::I32, candidates_size, NC});
+            _candidates->allocate();
+
+            _num_candidates = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
+            _num_candidates->allocate();
+
+            _scores_scratch.resize(parallel_get_max_threads());
+
             addConfig(layer, {DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
@@ -134,6 +148,40 @@ public:
         int *buffer_data           = _buffer->buffer();
         int *indices_data          = _indices->buffer();
         int *num_priors_actual     = _num_priors_actual->buffer();
+        int *candidates_data       = _candidates->buffer();
+        int *num_candidates        = _num_candidates->buffer();
+
+        for (int n = 0; n < N; ++n) {
+            const float *ppriors = prior_data;
+            if (_priors_batches)
+                ppriors += _variance_encoded_in_target ? n*_num_priors*_prior_size : 2*n*_num_priors*_prior_size;
+            num_priors_actual[n] = getActualPriorNum(ppriors);
+        }
+
+        // Reorder confidences to [N, C, P] and mark priors which pass the confidence threshold
+        // in at least one class. Other priors never reach NMS, so their boxes are not decoded.
+        const int num_prior_blocks = (_num_priors + PRIORS_BLOCK - 1) / PRIORS_BLOCK;
+        parallel_for2d(N, num_prior_blocks, [&](int n, int pb) {
+            const int p_end = (std::min)(_num_priors, (pb + 1) * PRIORS_BLOCK);
+            float *pconf_dst = reordered_conf_data + n*_num_classes*_num_priors;
+            int *pcandidate = candidates_data + n*_num_priors;
+            for (int p = pb * PRIORS_BLOCK; p < p_end; ++p) {
+                const float *pconf = conf_data + (n*_num_priors + p)*_num_classes;
+                for (int c = 0; c < _num_classes; ++c)
+                    pconf_dst[c*_num_priors + p] = pconf[c];
+                pcandidate[p] = p < num_priors_actual[n] && isCandidate(pconf);
+            }
+        });
+
+        parallel_for(N, [&](int n) {
+            int *pcandidates = candidates_data + n*_num_priors;
+            int count = 0;
+            for (int p = 0; p < num_priors_actual[n]; ++p) {
+                if (pcandidates[p])
+                    pcandidates[count++] = p;
+            }
+            num_candidates[n] = count;
+        });
 
         for (int n = 0; n < N; ++n) {
             const float *ppriors = prior_data;
@@ -142,12 +190,13 @@ public:
                 ppriors += _variance_encoded_in_target ? n*_num_priors*_prior_size : 2*n*_num_priors*_prior_size;
                 prior_variances += _variance_encoded_in_target ? 0 : n*_num_priors*_prior_size;
             }
+            const int *pcandidates = candidates_data + n*_num_priors;
 
             if (_share_location) {
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
+                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, pcandidates, num_candidates[n]);
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
                     if (c == _background_label_id) {
@@ -157,57 +206,60 @@ public:
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
                     float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, pcandidates, num_candidates[n]);
                 }
             }
         }
 
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+        memset(detections_data, 0, N*_num_classes*sizeof(int));
+
+        if (!_decrease_label_id) {
+            // Caffe style: classes of all images are processed independently
+            const int work_amount = N * _num_classes;
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(work_amount, nthr, ithr, start, end);
+                for (int iwork = start; iwork < end; ++iwork) {
+                    const int n = iwork / _num_classes;
+                    const int c = iwork % _num_classes;
+                    if (c == _background_label_id)  // Ignore background class
+                        continue;
+
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
+                    }
+
+                    nms_cf(pconf, pboxes, psizes, candidates_data + n*_num_priors, num_candidates[n],
+                           _scores_scratch[ithr], pindices, *pdetections);
                 }
-            }
+            });
         }
 
-        memset(detections_data, 0, N*_num_classes*sizeof(int));
-
         for (int n = 0; n < N; ++n) {
             int detections_total = 0;
 
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
-                    }
-                });
-            } else {
+            if (_decrease_label_id) {
                 // MXNet style
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
                 const float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
-                nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
+                nms_mx(pconf, pboxes, psizes, candidates_data + n*_num_priors, num_candidates[n],
+                       pbuffer, pindices, pdetections);
             }
 
             for (int c = 0; c < _num_classes; ++c) {
@@ -215,7 +267,8 @@ public:
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                auto &conf_index_class_map = _conf_index_class_map;
+                conf_index_class_map.clear();
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -228,8 +281,8 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                  conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -343,14 +396,41 @@ private:
         CENTER_SIZE = 2,
     };
 
+    // Number of priors decoded together, keeps reordering of confidences within the cache
+    const int PRIORS_BLOCK = 256;
+
+    int getActualPriorNum(const float *prior_data) const;
+
+    // Checks whether the prior passes the confidence threshold in any class, conf_data points to its [C] scores
+    inline bool isCandidate(const float *conf_data) const {
+        if (_decrease_label_id) {
+            float conf = -1;
+            int id = 0;
+            for (int c = 1; c < _num_classes; ++c) {
+                if (conf_data[c] > conf) {
+                    conf = conf_data[c];
+                    id = c;
+                }
+            }
+            return id > 0 && conf >= _confidence_threshold;
+        }
+        for (int c = 0; c < _num_classes; ++c) {
+            if (c != _background_label_id && conf_data[c] > _confidence_threshold)
+                return true;
+        }
+        return false;
+    }
+
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+                      float *decoded_bboxes, float *decoded_bbox_sizes, const int *priors, int num_priors);
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                const int *candidates, int num_candidates, std::vector<std::pair<float, int>> &scores,
+                int *indices, int &detections);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int *detections, int num_priors_actual);
+                const int *candidates, int num_candidates,
+                int *buffer, int *indices, int *detections);
 
     InferenceEngine::Blob::Ptr _decoded_bboxes;
     InferenceEngine::Blob::Ptr _buffer;
@@ -359,6 +439,12 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+    InferenceEngine::Blob::Ptr _candidates;
+    InferenceEngine::Blob::Ptr _num_candidates;
+
+    // Scratch buffers keep their capacity between inferences
+    std::vector<std::vector<std::pair<float, int>>> _scores_scratch;
+    std::vector<std::pair<float, std::pair<int, int>>> _conf_index_class_map;
 };
 
 struct ConfidenceComparator {
@@ -410,26 +496,26 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
-void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
-                                   const float *loc_data,
-                                   const float *variance_data,
-                                   float *decoded_bboxes,
-                                   float *decoded_bbox_sizes,
-                                   int* num_priors_actual,
-                                   int n) {
-    num_priors_actual[n] = _num_priors;
+int DetectionOutputImpl::getActualPriorNum(const float *prior_data) const {
     if (!_normalized) {
-        int num = 0;
-        for (; num < _num_priors; ++num) {
+        for (int num = 0; num < _num_priors; ++num) {
             float batch_id = prior_data[num * _prior_size + 0];
-            if (batch_id == -1.f) {
-                num_priors_actual[n] = num;
-                break;
-            }
+            if (batch_id == -1.f)
+                return num;
         }
     }
+    return _num_priors;
+}
 
-    parallel_for(num_priors_actual[n], [&](int p) {
+void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
+                                   const float *loc_data,
+                                   const float *variance_data,
+                                   float *decoded_bboxes,
+                                   float *decoded_bbox_sizes,
+                                   const int *priors,
+                                   int num_priors) {
+    parallel_for(num_priors, [&](int i) {
+        const int p = priors[i];
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
@@ -513,26 +599,26 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
-                          int* buffer,
+                          const int* candidates,
+                          int num_candidates,
+                          std::vector<std::pair<float, int>>& scores,
                           int* indices,
-                          int& detections,
-                          int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
+                          int& detections) {
+    // Scores are sorted together with indices to avoid indirect access to confidences
+    scores.clear();
+    for (int i = 0; i < num_candidates; ++i) {
+        const int idx = candidates[i];
+        if (conf_data[idx] > _confidence_threshold)
+            scores.emplace_back(conf_data[idx], idx);
     }
 
+    const int count = static_cast<int>(scores.size());
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    std::partial_sort(scores.begin(), scores.begin() + num_output_scores, scores.end(), SortScoreIndexDescend);
 
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
+        const int idx = scores[i].second;
 
         bool keep = true;
         for (int k = 0; k < detections; ++k) {
@@ -553,16 +639,18 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
 void DetectionOutputImpl::nms_mx(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
+                          const int* candidates,
+                          int num_candidates,
                           int* buffer,
                           int* indices,
-                          int* detections,
-                          int num_priors_actual) {
+                          int* detections) {
     int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
+    for (int i = 0; i < num_candidates; ++i) {
+        const int prior = candidates[i];
         float conf = -1;
         int id = 0;
         for (int c = 1; c < _num_classes; ++c) {
-            float temp = conf_data[c*_num_priors + i];
+            float temp = conf_data[c*_num_priors + prior];
             if (temp > conf) {
                 conf = temp;
                 id = c;
@@ -570,37 +658,45 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         }
 
         if (id > 0 && conf >= _confidence_threshold) {
-            indices[count++] = id*_num_priors + i;
+            indices[count++] = id*_num_priors + prior;
         }
     }
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    std::partial_sort(indices, indices + num_output_scores, indices + count, ConfidenceComparator(conf_data));
 
+    // Boxes of different classes never suppress each other: split the sorted candidates by class
+    // keeping their order and run NMS for classes in parallel
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-        const int cls = idx/_num_priors;
-        const int prior = idx%_num_priors;
+        const int cls = indices[i] / _num_priors;
+        buffer[cls*_num_priors + detections[cls]++] = indices[i] % _num_priors;
+    }
 
-        int &ndetection = detections[cls];
+    parallel_for(_num_classes, [&](int cls) {
+        const int *pbuffer = buffer + cls*_num_priors;
+        const int num_class_scores = detections[cls];
         int *pindices = indices + cls*_num_priors;
-
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
+        int ndetection = 0;
+
+        for (int i = 0; i < num_class_scores; ++i) {
+            const int prior = pbuffer[i];
+
+            bool keep = true;
+            for (int k = 0; k < ndetection; ++k) {
+                const int kept_idx = pindices[k];
+                float overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
+                if (overlap > _nms_threshold) {
+                    keep = false;
+                    break;
+                }
+            }
+            if (keep) {
+                pindices[ndetection++] = prior;
             }
         }
-        if (keep) {
-            pindices[ndetection++] = prior;
-        }
-    }
+        detections[cls] = ndetection;
+    });
 }
 
 REG_FACTORY_FOR(DetectionOutputImpl, DetectionOutput);
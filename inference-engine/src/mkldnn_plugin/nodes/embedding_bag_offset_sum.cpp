@@ -120,8 +120,7 @@ protected:
 
         const size_t OUTPUT_BAGS_NUM = outputs[0]->getTensorDesc().getDims()[0];
 
-        std::function<void(size_t, const I*&, size_t&, size_t&, bool&)> get_idx =
-                [&](size_t embIndex, const I*& indicesRef, size_t& outSize, size_t& weightsIdx, bool& withWeights) {
+        auto get_idx = [&](size_t embIndex, const I*& indicesRef, size_t& outSize, size_t& weightsIdx, bool& withWeights) {
             if (embIndex >= _offsetsLen) {
                 errorMsg = msgPrefix + "has invalid embedding bag index.";
                 return;
@@ -169,50 +168,20 @@ protected:
             bool withWeights = _withWeights;
 
             for (size_t obi = start; obi < end; obi++) {
-                size_t dstIndex = obi * _embDepth;
+                T* dst = dstData + obi * _embDepth;
                 get_idx(obi, indices, indicesSize, weightsIdx, withWeights);
                 if (indices != nullptr) {
                     withWeights = withWeights & _withWeights;
 
-                    size_t inIdx = 0lu;
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                    size_t invalidIndex = 0lu;
+                    if (!sumRows(srcData, inDataDims[0], indices, indicesSize,
+                                 withWeights ? weightsData + weightsIdx : nullptr, dst, invalidIndex)) {
+                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(invalidIndex);
                         return;
                     }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i];
-                        }
-                    }
-
-                    for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                        if (indices[inIdx] >= inDataDims[0]) {
-                            errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                            return;
-                        }
-                        size_t srcIndex = indices[inIdx] * _embDepth;
-
-                        if (withWeights) {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                            }
-                            weightsIdx++;
-                        } else {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i];
-                            }
-                        }
-                    }
                 } else {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = 0;
+                        dst[i] = 0;
                     }
                 }
             }
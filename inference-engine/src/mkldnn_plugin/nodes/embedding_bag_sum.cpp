@@ -4,19 +4,36 @@
 
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
-#include "jit_generator.hpp"
 #include "list.hpp"
 
 #include <set>
 #include <string>
 #include <vector>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 using namespace InferenceEngine;
 using namespace InferenceEngine::Extensions::Cpu;
 
+// HAVE_* ISA macros are defined only for cross compiled files, so the compiler intrinsic is used directly
+static inline void prefetchCacheLine(const char* ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(ptr, _MM_HINT_T0);
+#endif
+}
 
 const std::set<size_t> MKLDNNEmbeddingBagSum::_supportedIndicesTypeSize = {sizeof(INT32), sizeof(INT64)};
 
+void MKLDNNEmbeddingBagSum::prefetchRow(const void* row, size_t bytes) noexcept {
+    const char* ptr = reinterpret_cast<const char*>(row);
+    for (size_t offset = 0lu; offset < bytes; offset += 64lu)
+        prefetchCacheLine(ptr + offset);
+}
+
 MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
             const CNNLayer* layer,
             size_t requiredInputNum,
@@ -158,49 +175,20 @@ void MKLDNNEmbeddingBagSum::processData(
         bool withWeights = _withWeights;
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
+            T* dst = dstData + obi * _embDepth;
             getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
+                size_t invalidIndex = 0lu;
+                if (!sumRows(srcData, inDataDims[0], indices, indicesSize,
+                             withWeights ? weightsData + weightsIdx : nullptr, dst, invalidIndex))
                     THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
+                        << "' has invalid embedding bag index: " << invalidIndex;
             } else {
                 for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] = 0;
                 }
             }
         }
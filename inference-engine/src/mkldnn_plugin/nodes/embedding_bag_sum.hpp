@@ -41,6 +41,52 @@ protected:
     template<typename T>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    // Hints the CPU to load the table row of the given size in bytes into cache
+    static void prefetchRow(const void* row, size_t bytes) noexcept;
+
+    // Stores to dstData the sum of the table rows selected by indices, each row is scaled by its weight if weights
+    // are given. The next selected row is prefetched while the current one is accumulated.
+    // Returns false and sets invalidIndex if an index is out of the table.
+    template<typename T, typename I>
+    bool sumRows(const T* srcData, size_t rowsNum, const I* indices, size_t indicesSize,
+                 const T* weights, T* dstData, size_t& invalidIndex) const noexcept {
+        const size_t embDepth = _embDepth;
+        T* __restrict dst = dstData;
+        for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+            const size_t index = static_cast<size_t>(indices[inIdx]);
+            if (index >= rowsNum) {
+                invalidIndex = index;
+                return false;
+            }
+            if (inIdx + 1lu < indicesSize) {
+                const size_t nextIndex = static_cast<size_t>(indices[inIdx + 1lu]);
+                if (nextIndex < rowsNum)
+                    prefetchRow(srcData + nextIndex * embDepth, embDepth * sizeof(T));
+            }
+
+            const T* __restrict src = srcData + index * embDepth;
+            if (weights != nullptr) {
+                const T weight = weights[inIdx];
+                if (inIdx == 0lu) {
+                    for (size_t i = 0lu; i < embDepth; i++)
+                        dst[i] = src[i] * weight;
+                } else {
+                    for (size_t i = 0lu; i < embDepth; i++)
+                        dst[i] += src[i] * weight;
+                }
+            } else {
+                if (inIdx == 0lu) {
+                    for (size_t i = 0lu; i < embDepth; i++)
+                        dst[i] = src[i];
+                } else {
+                    for (size_t i = 0lu; i < embDepth; i++)
+                        dst[i] += src[i];
+                }
+            }
+        }
+        return true;
+    }
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -74,6 +74,18 @@ public:
             }
         }
 
+        // Find the first index and the size of every segment in one pass instead of scanning all segment ids per bag
+        _segmentBegins.assign(_numSegments, 0lu);
+        _segmentSizes.assign(_numSegments, 0lu);
+        for (size_t si = 0; si < _segmentIds.size(); si++) {
+            const size_t segmentId = _segmentIds[si];
+            if (segmentId >= _numSegments)
+                continue;
+            if (_segmentSizes[segmentId] == 0lu)
+                _segmentBegins[segmentId] = si;
+            _segmentSizes[segmentId]++;
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -92,17 +104,12 @@ public:
             THROW_IE_EXCEPTION << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentSizes[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
+        if (size != 0lu) {
+            indices = _indices.data() + _segmentBegins[embIndex];
+            weightsIdx = _segmentBegins[embIndex];
         }
 
         // Empty bag
@@ -124,6 +131,8 @@ protected:
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
     std::vector<size_t> _defaultIndices;
+    std::vector<size_t> _segmentBegins;
+    std::vector<size_t> _segmentSizes;
 };
 
 REG_FACTORY_FOR(EmbeddingSegmentsSumImpl, EmbeddingSegmentsSum);
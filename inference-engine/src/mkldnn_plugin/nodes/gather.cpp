@@ -5,13 +5,13 @@
 #include "base.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
 #include <algorithm>
 #include <limits>
 #include "ie_parallel.hpp"
-#include "common/simple_copy.h"
 #include "common/fp16_utils.h"
 
 namespace InferenceEngine {
@@ -118,22 +118,63 @@ private:
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
 
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
+        //  Rows of one element are copied as typed values, longer rows are copied with memcpy
+        switch (len) {
+            case sizeof(uint8_t):
+                gatherElements<uint8_t, index_t, Conversion>(src_index, src_indexSize, src_dataDict, dst_data);
+                break;
+            case sizeof(uint16_t):
+                gatherElements<uint16_t, index_t, Conversion>(src_index, src_indexSize, src_dataDict, dst_data);
+                break;
+            case sizeof(uint32_t):
+                gatherElements<uint32_t, index_t, Conversion>(src_index, src_indexSize, src_dataDict, dst_data);
+                break;
+            case sizeof(uint64_t):
+                gatherElements<uint64_t, index_t, Conversion>(src_index, src_indexSize, src_dataDict, dst_data);
+                break;
+            default:
+                gatherRows<index_t, Conversion>(src_index, src_indexSize, src_dataDict, dst_data, len);
+                break;
+        }
+    }
+
+    template <typename data_t, typename index_t, class Conversion>
+    void gatherElements(const index_t *src_index, size_t src_indexSize, const uint8_t *src_dataDict, uint8_t *dst_data) {
+        const data_t *src = reinterpret_cast<const data_t *>(src_dataDict);
+        data_t *dst = reinterpret_cast<data_t *>(dst_data);
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(numDictionaries * src_indexSize, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            size_t j = start / src_indexSize;
+            size_t i = start % src_indexSize;
+            for (size_t k = start; k < end; k++) {
+                auto idx = Conversion()(src_index[i]);
+                //  Index clipping
+                dst[k] = idx < indexRange ? src[idx + j * indexRange] : static_cast<data_t>(0);
+                if (++i == src_indexSize) {
+                    i = 0;
+                    j++;
+                }
+            }
+        });
+    }
+
+    template <typename index_t, class Conversion>
+    void gatherRows(const index_t *src_index, size_t src_indexSize, const uint8_t *src_dataDict, uint8_t *dst_data, size_t len) {
+        parallel_for2d(numDictionaries, src_indexSize, [&](size_t j, size_t i) {
+            auto idx = Conversion()(src_index[i]);
+            uint8_t *dst = &dst_data[len * (i + j * src_indexSize)];
 
             //  Index clipping
             if (idx < indexRange) {
                 //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    simple_copy(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
+                memcpy(dst, &src_dataDict[len * (idx + j * indexRange)], len);
             } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
-                }
+                memset(dst, 0, len);
             }
         });
     }
@@ -76,6 +76,7 @@ MKLDNN_EXTENSION_NODE(GatherImpl, Gather);
 MKLDNN_EXTENSION_NODE(ProposalImpl, Proposal);
 MKLDNN_EXTENSION_NODE(RangeImpl, Range);
 MKLDNN_EXTENSION_NODE(SelectImpl, Select);
+MKLDNN_EXTENSION_NODE(ScaledDotProductAttentionImpl, ScaledDotProductAttention);
 MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceAnd);
 MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceL1);
 MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceL2);
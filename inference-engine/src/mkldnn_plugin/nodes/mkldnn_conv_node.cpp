@@ -15,6 +15,8 @@
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <functional>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_layers_internal.hpp>
@@ -664,6 +666,21 @@ bool MKLDNNConvolutionNode::created() const {
     return getType() == Convolution;
 }
 
+uint64_t MKLDNNConvolutionNode::estimateFlops() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    if (!selectedPrimitiveDesc || selectedPrimitiveDesc->getConfig().outConfs.empty() || weightDims.empty())
+        return MKLDNNNode::estimateFlops();
+
+    const auto& dstDims = selectedPrimitiveDesc->getConfig().outConfs[0].desc.getDims();
+    if (dstDims.size() < 2 || dstDims[1] == 0)
+        return MKLDNNNode::estimateFlops();
+
+    // every output point is a dot product of input channels of its group and the kernel
+    const auto weightsCount = std::accumulate(weightDims.begin(), weightDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    const auto dstCount = std::accumulate(dstDims.begin(), dstDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * dstCount * (weightsCount / dstDims[1]);
+}
+
 void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                              const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
@@ -29,6 +29,7 @@ public:
     void filterSupportedDescriptors();
     bool isPossibleToSkipInitConfig(MKLDNNDescriptor &desc);
     bool created() const override;
+    uint64_t estimateFlops() const override;
     bool canBeInPlace() const override {
         return false;
     }
@@ -10,6 +10,8 @@
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <functional>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 
@@ -277,6 +279,19 @@ bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
 
+uint64_t MKLDNNFullyConnectedNode::estimateFlops() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    if (!selectedPrimitiveDesc || selectedPrimitiveDesc->getConfig().outConfs.empty() ||
+        weightsDims.empty() || weightsDims[0] == 0)
+        return MKLDNNNode::estimateFlops();
+
+    // every output is a dot product of the input features and a row of weights
+    const auto& dstDims = selectedPrimitiveDesc->getConfig().outConfs[0].desc.getDims();
+    const auto weightsCount = std::accumulate(weightsDims.begin(), weightsDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    const auto dstCount = std::accumulate(dstDims.begin(), dstDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * dstCount * (weightsCount / weightsDims[0]);
+}
+
 memory::format MKLDNNFullyConnectedNode::weightsFormatForSrcFormat(memory::format sourceFormat) {
     switch (sourceFormat) {
         case memory::format::x:
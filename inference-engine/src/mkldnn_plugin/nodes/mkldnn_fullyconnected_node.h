@@ -20,6 +20,7 @@ public:
     void getSupportedDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    uint64_t estimateFlops() const override;
     bool canBeInPlace() const override {
         return false;
     }
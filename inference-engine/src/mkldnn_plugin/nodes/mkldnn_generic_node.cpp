@@ -7,7 +7,6 @@
 #include "mkldnn_generic_node.h"
 #include <vector>
 #include <string>
-#include <blob_factory.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -69,7 +68,11 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 }
 
 void MKLDNNGenericNode::createPrimitive() {
-    if (extFactory || !impls.empty()) {
+    if (!impls.empty()) {
+        initBlobs();
+        return;
+    }
+    if (extFactory) {
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -112,51 +115,50 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
+void MKLDNNGenericNode::initBlobs() {
+    inputEdges.clear();
+    outputEdges.clear();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
-            isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
-        }
+        inputEdges.push_back(getParentEdgeAt(i));
     }
-
-    if (isDynBatch) {
-        // TODO: use ngraph-based extension mechnism if needed to recompute shape
-        isDynBatch = false;
+    for (size_t i = 0; i < outDims.size(); i++) {
+        outputEdges.push_back(getChildEdgesAtPort(i)[0]);
     }
+    inputBlobs.assign(inputEdges.size(), nullptr);
+    inputPtrs.assign(inputEdges.size(), nullptr);
+    outputBlobs.assign(outputEdges.size(), nullptr);
+    outputPtrs.assign(outputEdges.size(), nullptr);
+    updateBlobs();
+}
 
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
-    }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
-    for (size_t i = 0; i < outDims.size(); i++) {
-        if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
-            auto td = out_edge->getBlob()->getTensorDesc();
-            td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
-        } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
+void MKLDNNGenericNode::updateBlobs() {
+    auto update = [](const std::vector<MKLDNNEdgeWeakPtr>& edges,
+                     std::vector<InferenceEngine::Blob::Ptr>& blobs,
+                     std::vector<void*>& ptrs) {
+        for (size_t i = 0; i < edges.size(); i++) {
+            auto edge = edges[i].lock();
+            if (!edge)
+                THROW_IE_EXCEPTION << "Edge is not available.";
+            void* data = edge->getMemory().GetData();
+            if (!blobs[i] || ptrs[i] != data) {
+                blobs[i] = edge->getBlob();
+                ptrs[i] = data;
+            }
         }
-    }
+    };
+    update(inputEdges, inputBlobs, inputPtrs);
+    update(outputEdges, outputBlobs, outputPtrs);
+}
+
+void MKLDNNGenericNode::execLayer() {
+    if (inputEdges.size() != getParentEdges().size() || outputEdges.size() != outDims.size())
+        initBlobs();
+    else
+        updateBlobs();
+
+    // TODO: extension layers get blobs with full batch, dynamic batch requires ngraph-based shape recomputation
     InferenceEngine::ResponseDesc resp;
-    InferenceEngine::StatusCode rc = impls[0]->execute(inputs, outputs, &resp);
+    InferenceEngine::StatusCode rc = impls[0]->execute(inputBlobs, outputBlobs, &resp);
     if (rc != InferenceEngine::OK) {
         THROW_IE_EXCEPTION << resp.msg;
     }
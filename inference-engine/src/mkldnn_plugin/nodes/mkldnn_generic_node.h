@@ -37,10 +37,21 @@ public:
 
 
 protected:
+    void initBlobs();
+    void updateBlobs();
+
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+
+    // Blob wrappers over edges memory are created once and recreated only when memory pointer is changed
+    std::vector<MKLDNNEdgeWeakPtr> inputEdges;
+    std::vector<MKLDNNEdgeWeakPtr> outputEdges;
+    std::vector<InferenceEngine::Blob::Ptr> inputBlobs;
+    std::vector<InferenceEngine::Blob::Ptr> outputBlobs;
+    std::vector<void*> inputPtrs;
+    std::vector<void*> outputPtrs;
 };
 
 }  // namespace MKLDNNPlugin
@@ -58,6 +58,10 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
+    // The state is kept in place by the graph allocator, so there is nothing to copy
+    if (src_ptr == dst_ptr)
+        return;
+
     // TODO: this can be eliminated by completely removing MKLDNN memory output NODE, to fuse it with output of prev layer
     memcpy(dst_ptr, src_ptr, srcMemory.GetSize());
 }
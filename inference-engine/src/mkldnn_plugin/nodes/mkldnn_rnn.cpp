@@ -4,10 +4,15 @@
 
 #include "mkldnn_rnn.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
+#include <ie_system_conf.h>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -135,22 +140,27 @@ void MKLDNNRNN::fillCellDesc() {
         THROW_IE_EXCEPTION << "RNN Layer. Biases size is not correct. Expected size:" << G*SC;
 
     // Shapes and Attributes are correct. Can start internal stuff initialization.
+    isInt8 = canUseInt8();
+    const auto data_type = isInt8 ? memory::u8 : memory::f32;
+    const auto weights_type = isInt8 ? memory::s8 : memory::f32;
+    // Quantized weights are stored in the layout preferred by the primitive
+    const auto weights_format = isInt8 ? memory::any : memory::ldigo;
 
     in_state_d  = {{L, D, S, N, SC}, memory::f32, memory::ldsnc};
     out_state_d = {{L, D, S, N, SC}, memory::f32, memory::ldsnc};
 
-    in_data_d  = {{T, N, DC}, memory::f32, memory::tnc};;
-    out_data_d = {{T, N, SC}, memory::f32, memory::tnc};;
+    in_data_d  = {{T, N, DC}, data_type, memory::tnc};
+    out_data_d = {{T, N, SC}, memory::f32, memory::tnc};
 
-    w_data_d   = {{L, D, DC, G, SC}, memory::f32, memory::ldigo};
-    w_state_d  = {{L, D, SC, G, SC}, memory::f32, memory::ldigo};
+    w_data_d   = {{L, D, DC, G, SC}, weights_type, weights_format};
+    w_state_d  = {{L, D, SC, G, SC}, weights_type, weights_format};
 
     if (bias)
         w_bias_d = {{L, D, Gb, SC}, memory::f32, memory::ldgo};
 
     std::vector<TensorDesc> in_candidate, out_candidate;
     std::vector<memory::format> outputFormats;
-    in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, memory::f32, memory::nc});
+    in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, data_type, memory::nc});
     in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::f32, memory::nc});
     out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::f32, memory::nc});
     outputFormats.emplace_back(memory::nc);
@@ -252,8 +262,13 @@ void MKLDNNRNN::fillSeqDesc() {
     if (weights->size() != G*SC*(SC+DC))
         THROW_IE_EXCEPTION << "RNN Layer. Weights size is not correct. Expected size:" << G*SC*(SC+DC);
 
-    w_data_d  = {{L, D, DC, G, SC}, memory::f32, memory::ldigo};
-    w_state_d = {{L, D, SC, G, SC}, memory::f32, memory::ldigo};
+    isInt8 = canUseInt8();
+    const auto data_type = isInt8 ? memory::u8 : memory::f32;
+    const auto weights_type = isInt8 ? memory::s8 : memory::f32;
+    const auto weights_format = isInt8 ? memory::any : memory::ldigo;
+
+    w_data_d  = {{L, D, DC, G, SC}, weights_type, weights_format};
+    w_state_d = {{L, D, SC, G, SC}, weights_type, weights_format};
 
     if (bias && bias->size() != Gb*SC)
         THROW_IE_EXCEPTION << "RNN Layer. Biases size is not correct. Expected size:" << G*SC;
@@ -262,14 +277,14 @@ void MKLDNNRNN::fillSeqDesc() {
         w_bias_d = {{L, D, Gb, SC}, memory::f32, memory::ldgo};
 
     // Try to create descriptor and corresponding configuration
-    in_data_d = {in_data_dims, memory::f32, memory::tnc};
+    in_data_d = {in_data_dims, data_type, memory::tnc};
     out_data_d = {out_data_dims, memory::f32, memory::tnc};
 
     std::vector<TensorDesc> in_candidate;
     if (nativeOrder)
         in_candidate.push_back(in_data_d);
     else
-        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, memory::f32, memory::ntc});
+        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, data_type, memory::ntc});
 
     for (int i = 1; i < ins.size(); i++)
         in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::f32, memory::nc});
@@ -333,18 +348,26 @@ void MKLDNNRNN::createPrimitive() {
     if (prim) return;
 
     std::shared_ptr<rnn_forward::desc> d = descs[0];
-    rnn_forward::primitive_desc pd(*d, getEngine());
+
+    primitive_attr attr;
+    if (isInt8) {
+        fillWeightsScales();
+        attr.set_int_output_round_mode(round_nearest);
+        attr.set_rnn_data_qparams(dataScale, dataShift);
+        attr.set_rnn_weights_qparams((1 << 3) | (1 << 4) /*through G and O dims of ldigo*/, weightsScales);
+    }
+    rnn_forward::primitive_desc pd(*d, attr, getEngine());
 
     auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
-    // create weight blobs (data and state part)
+    // create weight blobs (data and state part), quantized ones are produced from them below
     auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_data_mem->Create(w_data_d);
+    w_data_mem->Create(MKLDNNMemoryDesc{{L, D, DC, G, SC}, memory::f32, memory::ldigo});
     internalBlobMemory.push_back(w_data_mem);
 
     auto w_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_state_mem->Create(w_state_d);
+    w_state_mem->Create(MKLDNNMemoryDesc{{L, D, SC, G, SC}, memory::f32, memory::ldigo});
     internalBlobMemory.push_back(w_state_mem);
 
     auto w_bias_mem = std::make_shared<MKLDNNMemory>(getEngine());
@@ -370,39 +393,7 @@ void MKLDNNRNN::createPrimitive() {
          *   ====== GRU ======
          *   IE - URO, mkldnn - URO
          */
-        const int gate_map_lstm[] = {1, 0, 2, 3};  // FICO -> IFCO
-        const int gate_map_gru[]  = {0, 1, 2, 3};
-        const int gate_map_rnn[]  = {0};
-        const int *gate_map;
-        const int gate_map_lstm_size = sizeof(gate_map_lstm) / sizeof(int);
-        const int gate_map_gru_size = sizeof(gate_map_gru) / sizeof(int);
-        const int gate_map_rnn_size = sizeof(gate_map_rnn) / sizeof(int);
-        if (cell_desc.get_cell_kind() == vanilla_lstm) {
-            gate_map = gate_map_lstm;
-            if (G > gate_map_lstm_size) {
-                THROW_IE_EXCEPTION << "G isn't equal to the size of gate_map";
-            }
-        } else if (cell_desc.get_cell_kind() == vanilla_gru) {
-            gate_map = gate_map_gru;
-            if (G > gate_map_gru_size) {
-                THROW_IE_EXCEPTION << "G isn't equal to the size of gate_map";
-            }
-        } else if (cell_desc.get_cell_kind() == gru_linear_before_reset) {
-            gate_map = gate_map_gru;
-            if (G > gate_map_gru_size) {
-                THROW_IE_EXCEPTION << "G isn't equal to the size of gate_map";
-            }
-        } else if (cell_desc.get_cell_kind() == vanilla_rnn) {
-            gate_map = gate_map_rnn;
-            if (G > gate_map_rnn_size) {
-                THROW_IE_EXCEPTION << "G isn't equal to the size of gate_map";
-            }
-        } else {
-            gate_map = gate_map_gru;
-            if (G > gate_map_gru_size) {
-                THROW_IE_EXCEPTION << "G isn't equal to the size of gate_map";
-            }
-        }
+        const int *gate_map = getGateMap();
 
         auto ie_w_ptr = getCnnLayer()->blobs["weights"]->buffer().as<const float*>();
         auto w_ptr = static_cast<float*>(w_data_mem->GetData());
@@ -441,6 +432,11 @@ void MKLDNNRNN::createPrimitive() {
         }
     }
 
+    if (isInt8) {
+        w_data_mem = quantizeWeights(w_data_mem, pd.weights_layer_primitive_desc(), attr);
+        w_state_mem = quantizeWeights(w_state_mem, pd.weights_iter_primitive_desc(), attr);
+    }
+
     auto src_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
     src_state_mem->Create(in_state_d);
     internalBlobMemory.push_back(src_state_mem);
@@ -502,6 +498,118 @@ void MKLDNNRNN::createPrimitive() {
     prim.reset(p);
 }
 
+bool MKLDNNRNN::canUseInt8() {
+    // s8 gemm is efficient only with AVX-512 integer instructions, otherwise FP32 is faster
+    if (cell_desc.get_cell_kind() != vanilla_lstm || !with_cpu_x86_avx512_core())
+        return false;
+
+    if (getCnnLayer()->insData[0].lock()->getPrecision() != Precision::U8)
+        return false;
+
+    // Weights are quantized from their FP32 values
+    auto weightsBlob = getCnnLayer()->blobs["weights"];
+    if (!weightsBlob || weightsBlob->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    // Quantization parameters of the data are taken from the producer, they have to be per tensor
+    auto quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(getParentEdgeAt(0)->getParent().get());
+    if (quantizeNode == nullptr || quantizeNode->isBinarization() ||
+        quantizeNode->getAlgorithm() != algorithm::quantization_quantize ||
+        quantizeNode->getOutputPrecision() != Precision::U8)
+        return false;
+
+    const auto& cropLow = quantizeNode->getCropLow();
+    const auto& cropHigh = quantizeNode->getCropHigh();
+    const auto& inputScale = quantizeNode->getInputScale();
+    const auto& inputShift = quantizeNode->getInputShift();
+    const auto& outputScale = quantizeNode->getOutputScale();
+    const auto& outputShift = quantizeNode->getOutputShift();
+    if (cropLow.size() != 1 || cropHigh.size() != 1 || inputScale.size() != 1 || inputShift.size() != 1 ||
+        outputScale.size() != 1 || outputShift.size() != 1)
+        return false;
+
+    // The primitive treats its input as u8 = data * dataScale + dataShift, so the Quantize output
+    // must be exactly the rounded input scale/shift result without any output rescaling
+    if (outputScale[0] != 1.f || outputShift[0] != 0.f)
+        return false;
+
+    // Values of the crop range have to stay within u8 after scale and shift, otherwise they are saturated
+    const float eps = 1e-3f;
+    const float u8Low = cropLow[0] * inputScale[0] + inputShift[0];
+    const float u8High = cropHigh[0] * inputScale[0] + inputShift[0];
+    if (u8Low < -eps || u8High > 255.f + eps)
+        return false;
+
+    dataScale = quantizeNode->getInputScale()[0];
+    dataShift = quantizeNode->getInputShift()[0];
+    return true;
+}
+
+const int* MKLDNNRNN::getGateMap() const {
+    /*
+     *   Gate order
+     *   ====== LSTM ======
+     *   Caffe - IFOC, ONNX   - IOFC
+     *   IE    - FICO, mkldnn - IFCO
+     *
+     *   ====== GRU ======
+     *   IE - URO, mkldnn - URO
+     */
+    static const int gate_map_lstm[] = {1, 0, 2, 3};  // FICO -> IFCO
+    static const int gate_map_gru[]  = {0, 1, 2, 3};
+    static const int gate_map_rnn[]  = {0};
+    const int gate_map_lstm_size = sizeof(gate_map_lstm) / sizeof(int);
+    const int gate_map_gru_size = sizeof(gate_map_gru) / sizeof(int);
+    const int gate_map_rnn_size = sizeof(gate_map_rnn) / sizeof(int);
+
+    const int *gate_map;
+    int gate_map_size;
+    if (cell_desc.get_cell_kind() == vanilla_lstm) {
+        gate_map = gate_map_lstm;
+        gate_map_size = gate_map_lstm_size;
+    } else if (cell_desc.get_cell_kind() == vanilla_rnn) {
+        gate_map = gate_map_rnn;
+        gate_map_size = gate_map_rnn_size;
+    } else {
+        gate_map = gate_map_gru;
+        gate_map_size = gate_map_gru_size;
+    }
+    if (G > gate_map_size) {
+        THROW_IE_EXCEPTION << "G isn't equal to the size of gate_map";
+    }
+    return gate_map;
+}
+
+void MKLDNNRNN::fillWeightsScales() {
+    // Symmetric s8 quantization, common for data and state weights of the same gate output
+    const int *gate_map = getGateMap();
+    auto ie_w_ptr = getCnnLayer()->blobs["weights"]->buffer().as<const float*>();
+
+    weightsScales.assign(G * SC, 1.f);
+    for (int g = 0; g < G; g++) {
+        for (int out_i = 0; out_i < SC; out_i++) {
+            const float *row = ie_w_ptr + (g*SC + out_i) * (DC + SC);
+            float max_abs = 0.f;
+            for (int in_i = 0; in_i < DC + SC; in_i++)
+                max_abs = (std::max)(max_abs, std::fabs(row[in_i]));
+            if (max_abs > 0.f)
+                weightsScales[gate_map[g]*SC + out_i] = 127.f / max_abs;
+        }
+    }
+}
+
+MKLDNNMemoryPtr MKLDNNRNN::quantizeWeights(const MKLDNNMemoryPtr& src, const memory::primitive_desc& dst_pd,
+                                           const primitive_attr& attr) {
+    auto dst = std::make_shared<MKLDNNMemory>(getEngine());
+    dst->Create(dst_pd.desc());
+    internalBlobMemory.push_back(dst);
+
+    reorder::primitive_desc reorder_pd(src->GetPrimitive().get_primitive_desc(), dst_pd, attr);
+    reorder quantize(reorder_pd, src->GetPrimitive(), dst->GetPrimitive());
+    mkldnn::stream(stream::kind::eager).submit({quantize});
+    return dst;
+}
+
 void MKLDNNRNN::execute(mkldnn::stream strm) {
     if (!exec_before.empty())
         strm.submit({exec_before.begin(), exec_before.end()});
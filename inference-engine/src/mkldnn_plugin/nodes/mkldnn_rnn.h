@@ -31,6 +31,13 @@ private:
     void fillCellDesc();
     void fillSeqDesc();
 
+    /** Checks whether input data is quantized to u8 by the parent Quantize node and takes its parameters */
+    bool canUseInt8();
+    const int* getGateMap() const;
+    void fillWeightsScales();
+    MKLDNNMemoryPtr quantizeWeights(const MKLDNNMemoryPtr& src, const mkldnn::memory::primitive_desc& dst_pd,
+                                    const mkldnn::primitive_attr& attr);
+
 private:
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
@@ -41,6 +48,14 @@ private:
     /** Direction of iteration through sequence dimension */
     mkldnn::rnn_direction direction = mkldnn::unidirectional;
 
+    /** u8 input data and s8 weights, LSTM only */
+    bool isInt8 = false;
+    /** Quantization of input data: u8 = data * dataScale + dataShift */
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+    /** Per gate and output channel scales of weights, in [G, SC] order */
+    std::vector<float> weightsScales;
+
     /** RNN Cell desc (type/activation_alg/clip)*/
     mkldnn::rnn_cell::desc cell_desc { mkldnn::algorithm::vanilla_lstm };
 
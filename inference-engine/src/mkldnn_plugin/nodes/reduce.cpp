@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include <ie_util_internal.hpp>
 #include "ie_parallel.hpp"
 
@@ -166,6 +167,10 @@ private:
     template <typename src_d, typename dst_t, typename F1, typename F2>
     void reduce(const src_d *src_data, dst_t* dst_data, size_t work_amount_dst, size_t reduced_dims_work_amount,
         SizeVector axes_for_reduction, SizeVector dst_dims, dst_t init_value, F1 func1, F2 func2);
+    template <typename src_d, typename dst_t, typename F1>
+    void reduce_contiguous(const src_d *src_data, dst_t* dst_data, size_t outer, size_t reduced, size_t inner,
+        dst_t init_value, F1 func1);
+    bool getContiguousReduction(const SizeVector& axes_for_reduction, size_t& outer, size_t& reduced, size_t& inner) const;
     template <typename src_d, typename dst_t>
     StatusCode reduce_type(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, size_t work_amount_dst, size_t reduced_dims_work_amount,
                 SizeVector axes_for_reduction, SizeVector dst_dims);
@@ -173,6 +178,7 @@ private:
 
     const size_t REDUCE_DATA = 0;
     const size_t REDUCE_INDEXES = 1;
+    const size_t REDUCE_BLOCK = 256;
     bool keep_dims = true;
     Reduce reduceMode = Reduce::Sum;
     SizeVector data_dims;
@@ -293,6 +299,17 @@ void ReduceImpl::reduce(
     F2           func2
 ) {
     unsigned int nthr = parallel_get_max_threads();
+
+    //  Reduction over one group of adjacent axes is done by unit stride loops without coordinates recalculation
+    size_t outer = 1, reduced = 1, inner = 1;
+    if (getContiguousReduction(axes_for_reduction, outer, reduced, inner) && outer * inner == work_amount_dst) {
+        size_t work_units = inner == 1 ? outer : outer * ((inner + REDUCE_BLOCK - 1) / REDUCE_BLOCK);
+        if (work_units >= nthr) {
+            reduce_contiguous(src_data, dst_data, outer, reduced, inner, init_value, func1);
+            return;
+        }
+    }
+
     if ((work_amount_dst + 1) >= nthr) {
         parallel_nt(0, [&](const int ithr, const int nthr) {
             int j;
@@ -387,6 +404,64 @@ void ReduceImpl::reduce(
     }
 }
 
+bool ReduceImpl::getContiguousReduction(const SizeVector& axes_for_reduction, size_t& outer, size_t& reduced, size_t& inner) const {
+    outer = reduced = inner = 1;
+    //  Dimensions equal to 1 don't affect memory order, the rest must look like [not reduced][reduced][not reduced]
+    bool reduced_started = false, reduced_finished = false;
+    for (size_t i = 0; i < src_dims.size(); i++) {
+        if (src_dims[i] == 1)
+            continue;
+        bool is_reduced = std::find(axes_for_reduction.begin(), axes_for_reduction.end(), i) != axes_for_reduction.end();
+        if (is_reduced) {
+            if (reduced_finished)
+                return false;
+            reduced_started = true;
+            reduced *= src_dims[i];
+        } else if (reduced_started) {
+            reduced_finished = true;
+            inner *= src_dims[i];
+        } else {
+            outer *= src_dims[i];
+        }
+    }
+    return true;
+}
+
+template <typename src_d, typename dst_t, typename F1>
+void ReduceImpl::reduce_contiguous(
+    const src_d *src_data,
+    dst_t       *dst_data,
+    size_t       outer,
+    size_t       reduced,
+    size_t       inner,
+    dst_t        init_value,
+    F1           func1
+) {
+    if (inner == 1) {
+        parallel_for(outer, [&](size_t o) {
+            const src_d *src = src_data + o * reduced;
+            dst_t reduce_prod = init_value;
+            for (size_t r = 0; r < reduced; r++)
+                reduce_prod = func1(reduce_prod, src[r]);
+            dst_data[o] = reduce_prod;
+        });
+    } else {
+        //  Inner dimension is processed by blocks, so accumulators stay in cache and loops are vectorized over it
+        parallel_for2d(outer, (inner + REDUCE_BLOCK - 1) / REDUCE_BLOCK, [&](size_t o, size_t b) {
+            const size_t start = b * REDUCE_BLOCK;
+            const size_t end = (std::min)(inner, start + REDUCE_BLOCK);
+            dst_t *dst = dst_data + o * inner;
+            for (size_t k = start; k < end; k++)
+                dst[k] = init_value;
+            for (size_t r = 0; r < reduced; r++) {
+                const src_d *src = src_data + (o * reduced + r) * inner;
+                for (size_t k = start; k < end; k++)
+                    dst[k] = func1(dst[k], src[k]);
+            }
+        });
+    }
+}
+
 REG_FACTORY_FOR(ReduceImpl, ReduceAnd);
 REG_FACTORY_FOR(ReduceImpl, ReduceL1);
 REG_FACTORY_FOR(ReduceImpl, ReduceL2);
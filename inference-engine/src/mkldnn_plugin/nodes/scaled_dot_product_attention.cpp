@@ -0,0 +1,222 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Computes Softmax(scale * Q x K^T + mask) x V row by row: every thread keeps a single row of scores,
+ * so the [Q_LEN, KV_LEN] attention matrix is never stored in memory.
+ */
+class ScaledDotProductAttentionImpl: public ExtLayerBase {
+public:
+    explicit ScaledDotProductAttentionImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.size() != 3 && layer->insData.size() != 4)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges.";
+            if (layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of output edges.";
+
+            for (const auto& in : layer->insData) {
+                Precision precision = in.lock()->getTensorDesc().getPrecision();
+                if (precision != Precision::FP32 && precision != Precision::BF16)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect input precision. Only FP32 is supported.";
+            }
+
+            scale = layer->GetParamAsFloat("scale", 1.f);
+            transpose_key = layer->GetParamAsBool("transpose_key", true);
+
+            const SizeVector& q_dims = layer->insData[Q_IDX].lock()->getTensorDesc().getDims();
+            const SizeVector& k_dims = layer->insData[K_IDX].lock()->getTensorDesc().getDims();
+            const SizeVector& v_dims = layer->insData[V_IDX].lock()->getTensorDesc().getDims();
+            const size_t rank = q_dims.size();
+            if (rank < 2 || k_dims.size() != rank || v_dims.size() != rank)
+                THROW_IE_EXCEPTION << layer->name << " Query, key and value must have equal rank >= 2.";
+
+            batch = 1;
+            for (size_t i = 0; i + 2 < rank; i++) {
+                if (q_dims[i] != k_dims[i] || q_dims[i] != v_dims[i])
+                    THROW_IE_EXCEPTION << layer->name << " Query, key and value must have equal batch dimensions.";
+                batch *= q_dims[i];
+            }
+
+            q_len = q_dims[rank - 2];
+            head_size = q_dims[rank - 1];
+            kv_len = transpose_key ? k_dims[rank - 2] : k_dims[rank - 1];
+            const size_t k_head_size = transpose_key ? k_dims[rank - 1] : k_dims[rank - 2];
+            value_size = v_dims[rank - 1];
+            if (k_head_size != head_size || v_dims[rank - 2] != kv_len)
+                THROW_IE_EXCEPTION << layer->name << " Inconsistent query, key and value shapes.";
+
+            const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
+            SizeVector expected_out_dims = q_dims;
+            expected_out_dims[rank - 1] = value_size;
+            if (out_dims != expected_out_dims)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect output shape.";
+
+            with_mask = layer->insData.size() == 4;
+            if (with_mask)
+                initMaskOffsets(layer, q_dims);
+
+            scratch.resize(static_cast<size_t>(parallel_get_max_threads()) * kv_len);
+
+            std::vector<DataConfigurator> in_data_conf(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, in_data_conf, { DataConfigurator(ConfLayout::PLN) });
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        const float* query = inputs[Q_IDX]->cbuffer().as<const float*>() +
+            inputs[Q_IDX]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float* key = inputs[K_IDX]->cbuffer().as<const float*>() +
+            inputs[K_IDX]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float* value = inputs[V_IDX]->cbuffer().as<const float*>() +
+            inputs[V_IDX]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float* mask = with_mask ? inputs[MASK_IDX]->cbuffer().as<const float*>() +
+            inputs[MASK_IDX]->getTensorDesc().getBlockingDesc().getOffsetPadding() : nullptr;
+        float* dst = outputs[0]->buffer().as<float*>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const size_t work_amount = batch * q_len;
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work_amount, nthr, ithr, start, end);
+            float* scores = &scratch[static_cast<size_t>(ithr) * kv_len];
+
+            for (size_t iwork = start; iwork < end; iwork++) {
+                const size_t b = iwork / q_len;
+                const size_t i = iwork % q_len;
+                const float* q_row = query + iwork * head_size;
+                const float* k_batch = key + b * kv_len * head_size;
+                const float* v_batch = value + b * kv_len * value_size;
+                float* dst_row = dst + iwork * value_size;
+
+                computeScores(q_row, k_batch, scores);
+
+                if (mask) {
+                    const float* mask_row = mask + mask_batch_offsets[b] + i * mask_row_stride;
+                    for (size_t j = 0; j < kv_len; j++)
+                        scores[j] += mask_row[j * mask_col_stride];
+                }
+
+                float max_score = -std::numeric_limits<float>::infinity();
+                for (size_t j = 0; j < kv_len; j++)
+                    max_score = (std::max)(max_score, scores[j]);
+                float sum = 0.f;
+                for (size_t j = 0; j < kv_len; j++) {
+                    scores[j] = std::exp(scores[j] - max_score);
+                    sum += scores[j];
+                }
+                const float inv_sum = 1.f / sum;
+
+                std::fill(dst_row, dst_row + value_size, 0.f);
+                for (size_t j = 0; j < kv_len; j++) {
+                    const float p = scores[j] * inv_sum;
+                    const float* v_row = v_batch + j * value_size;
+                    for (size_t d = 0; d < value_size; d++)
+                        dst_row[d] += p * v_row[d];
+                }
+            }
+        });
+
+        return OK;
+    }
+
+private:
+    void computeScores(const float* q_row, const float* k_batch, float* scores) const {
+        if (transpose_key) {
+            // Key rows are contiguous: one dot product per key
+            for (size_t j = 0; j < kv_len; j++) {
+                const float* k_row = k_batch + j * head_size;
+                float acc = 0.f;
+                for (size_t d = 0; d < head_size; d++)
+                    acc += q_row[d] * k_row[d];
+                scores[j] = acc * scale;
+            }
+        } else {
+            // Key is stored as [HEAD_SIZE, KV_LEN]: accumulate whole score row per head element
+            std::fill(scores, scores + kv_len, 0.f);
+            for (size_t d = 0; d < head_size; d++) {
+                const float q = q_row[d] * scale;
+                const float* k_row = k_batch + d * kv_len;
+                for (size_t j = 0; j < kv_len; j++)
+                    scores[j] += q * k_row[j];
+            }
+        }
+    }
+
+    void initMaskOffsets(const CNNLayer* layer, const SizeVector& q_dims) {
+        const SizeVector& mask_dims = layer->insData[MASK_IDX].lock()->getTensorDesc().getDims();
+        const size_t rank = q_dims.size();
+        if (mask_dims.size() > rank)
+            THROW_IE_EXCEPTION << layer->name << " Mask rank must not exceed rank of the scores.";
+
+        // Scores shape is [..., Q_LEN, KV_LEN]; mask is broadcast to it numpy-style
+        SizeVector scores_dims = q_dims;
+        scores_dims[rank - 1] = kv_len;
+        SizeVector dims(rank, 1);
+        std::copy(mask_dims.begin(), mask_dims.end(), dims.begin() + (rank - mask_dims.size()));
+
+        SizeVector strides(rank, 0);
+        size_t stride = 1;
+        for (size_t i = rank; i-- > 0;) {
+            if (dims[i] != 1 && dims[i] != scores_dims[i])
+                THROW_IE_EXCEPTION << layer->name << " Mask is not broadcastable to the scores shape.";
+            strides[i] = dims[i] == 1 ? 0 : stride;
+            stride *= dims[i];
+        }
+        mask_row_stride = strides[rank - 2];
+        mask_col_stride = strides[rank - 1];
+
+        mask_batch_offsets.assign(batch, 0);
+        for (size_t b = 0; b < batch; b++) {
+            size_t rest = b;
+            size_t offset = 0;
+            for (size_t i = rank - 2; i-- > 0;) {
+                offset += (rest % scores_dims[i]) * strides[i];
+                rest /= scores_dims[i];
+            }
+            mask_batch_offsets[b] = offset;
+        }
+    }
+
+    const size_t Q_IDX = 0;
+    const size_t K_IDX = 1;
+    const size_t V_IDX = 2;
+    const size_t MASK_IDX = 3;
+
+    float scale = 1.f;
+    bool transpose_key = true;
+    bool with_mask = false;
+
+    size_t batch = 1;
+    size_t q_len = 0;
+    size_t kv_len = 0;
+    size_t head_size = 0;
+    size_t value_size = 0;
+
+    size_t mask_row_stride = 0;
+    size_t mask_col_stride = 0;
+    std::vector<size_t> mask_batch_offsets;
+
+    std::vector<float> scratch;
+};
+
+REG_FACTORY_FOR(ScaledDotProductAttentionImpl, ScaledDotProductAttention);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
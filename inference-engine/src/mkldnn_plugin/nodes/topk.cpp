@@ -11,6 +11,7 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -100,6 +101,7 @@ public:
             }
             dim = static_cast<int>(src_dims[axis]);
             before_num = count(src_dims, 0, axis);
+            scratch.resize(parallel_get_max_threads());
 
             if (layer->outData.size() == 1) {
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) },
@@ -457,11 +459,124 @@ public:
         });
     }
 
+    struct TopKEntry {
+        float value;
+        int index;
+    };
+
+    // Order of the selected elements: better value first, lower index first among equal values
+    template <template <typename> class Compare>
+    struct EntryCompare {
+        bool operator()(const TopKEntry& a, const TopKEntry& b) const {
+            return Compare<float>()(a.value, b.value) || (a.value == b.value && a.index < b.index);
+        }
+    };
+
+    // Keeps the worst of the k selected elements on top of the heap,
+    // so most elements of a long axis are rejected with a single comparison
+    template <template <typename> class Compare>
+    void heap_select(const float* src_data, int start, int end, int k, std::vector<TopKEntry>& heap) {
+        EntryCompare<Compare> better;
+        heap.clear();
+        if (k <= 0)
+            return;
+        for (int i = start; i < start + k; i++)
+            heap.push_back(TopKEntry{src_data[i], i});
+        std::make_heap(heap.begin(), heap.end(), better);
+        for (int i = start + k; i < end; i++) {
+            // Indexes grow, so an element equal to the worst selected one never replaces it
+            if (Compare<float>()(src_data[i], heap.front().value)) {
+                std::pop_heap(heap.begin(), heap.end(), better);
+                heap.back() = TopKEntry{src_data[i], i};
+                std::push_heap(heap.begin(), heap.end(), better);
+            }
+        }
+    }
+
+    // Linear time selection for k comparable with the axis length
+    template <template <typename> class Compare>
+    void partial_select(const float* src_data, int k, std::vector<TopKEntry>& selected) {
+        selected.resize(dim);
+        for (int i = 0; i < dim; i++)
+            selected[i] = TopKEntry{src_data[i], i};
+        std::nth_element(selected.begin(), selected.begin() + (k - 1), selected.end(), EntryCompare<Compare>());
+        selected.resize(k);
+    }
+
+    template <template <typename> class Compare>
+    void store_selected(std::vector<TopKEntry>& selected, float* dst_data, int* dst_idx, size_t i0) {
+        if (sort_value) {
+            std::sort(selected.begin(), selected.end(), EntryCompare<Compare>());
+        } else {
+            std::sort(selected.begin(), selected.end(), [](const TopKEntry& a, const TopKEntry& b) {
+                return a.index < b.index;
+            });
+        }
+        if (dst_data) {
+            for (int i = 0; i < src_k; i++)
+                dst_data[i0 * src_k + i] = selected[i].value;
+        }
+        if (dst_idx) {
+            for (int i = 0; i < src_k; i++)
+                dst_idx[i0 * src_k + i] = selected[i].index;
+        }
+    }
+
+    // Large k along the innermost axis: independent slices are distributed between threads
+    template <template <typename> class Compare>
+    void topk_select(const float* src_data, float* dst_data, int* dst_idx) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            splitter(before_num, nthr, ithr, start, end);
+            auto& selected = scratch[ithr];
+            for (int i0 = start; i0 < end; i0++) {
+                const float* src = src_data + static_cast<size_t>(i0) * dim;
+                if (src_k * TOPK_HEAP_RATIO <= dim)
+                    heap_select<Compare>(src, 0, dim, src_k, selected);
+                else
+                    partial_select<Compare>(src, src_k, selected);
+                store_selected<Compare>(selected, dst_data, dst_idx, i0);
+            }
+        });
+    }
+
+    // Few long slices (e.g. vocabulary logits of a single sequence): every thread selects
+    // top k of its part of the axis and the candidates are merged afterwards
+    template <template <typename> class Compare>
+    void topk_split_axis(const float* src_data, float* dst_data, int* dst_idx) {
+        for (int i0 = 0; i0 < before_num; i0++) {
+            const float* src = src_data + static_cast<size_t>(i0) * dim;
+            for (auto& selected : scratch)
+                selected.clear();
+
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(dim, nthr, ithr, start, end);
+                heap_select<Compare>(src, start, end, (std::min)(src_k, end - start), scratch[ithr]);
+            });
+
+            candidates.clear();
+            for (const auto& selected : scratch)
+                candidates.insert(candidates.end(), selected.begin(), selected.end());
+            std::nth_element(candidates.begin(), candidates.begin() + (src_k - 1), candidates.end(), EntryCompare<Compare>());
+            candidates.resize(src_k);
+            store_selected<Compare>(candidates, dst_data, dst_idx, i0);
+        }
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         src_k = (inputs[TOPK_K]->cbuffer().as<int *>() +
             inputs[TOPK_K]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0];
+        // Selection paths index the k-th element and split the axis by k, so k must be positive
+        if (src_k <= 0) {
+            if (resp) {
+                std::string errorMsg = "TopK k must be positive, got " + std::to_string(src_k);
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return PARAMETER_MISMATCH;
+        }
         float* dst_data = nullptr;
         int* dst_idx = nullptr;
 
@@ -511,7 +626,18 @@ public:
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
-        if (src_k == 1) {
+        if (is_last_dim && before_num < parallel_get_max_threads() && dim >= TOPK_SPLIT_AXIS_MIN &&
+                src_k * parallel_get_max_threads() * TOPK_HEAP_RATIO <= dim) {
+            if (mode_max)
+                topk_split_axis<std::greater>(src, dst_data, dst_idx);
+            else
+                topk_split_axis<std::less>(src, dst_data, dst_idx);
+        } else if (is_last_dim && src_k > TOPK_INSERTION_MAX_K) {
+            if (mode_max)
+                topk_select<std::greater>(src, dst_data, dst_idx);
+            else
+                topk_select<std::less>(src, dst_data, dst_idx);
+        } else if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
                     top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -559,6 +685,16 @@ private:
 
     int dim, before_num;
 
+    // Insertion into the sorted k-length buffer is the fastest for small k
+    const int TOPK_INSERTION_MAX_K = 16;
+    // Heap selection is used while k is much smaller than the axis, partial sort otherwise
+    const int TOPK_HEAP_RATIO = 16;
+    // Minimal axis length worth splitting between threads
+    const int TOPK_SPLIT_AXIS_MIN = 32768;
+
+    std::vector<std::vector<TopKEntry>> scratch;
+    std::vector<TopKEntry> candidates;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
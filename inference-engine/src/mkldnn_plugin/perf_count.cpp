@@ -0,0 +1,173 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+#ifdef __linux__
+constexpr int hwEventsNum = 3;
+
+// Order of events matches HwCounterValues fields
+constexpr uint64_t hwEvents[hwEventsNum] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+};
+
+int openHwEvent(uint64_t event, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = event;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // pid = 0 and cpu = -1 count the calling thread on any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+int openHwEventsGroup() {
+    const auto groupFd = openHwEvent(hwEvents[0], -1);
+    if (groupFd < 0)
+        return -1;
+
+    for (int i = 1; i < hwEventsNum; i++) {
+        // members are closed together with the leader
+        if (openHwEvent(hwEvents[i], groupFd) < 0) {
+            close(groupFd);
+            return -1;
+        }
+    }
+
+    return groupFd;
+}
+#endif
+
+}  // namespace
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+namespace {
+
+struct AttachedArena {
+    // the arena of the calling thread, the observer is bound to it
+    tbb::task_arena arena {tbb::task_arena::attach{}};
+};
+
+}  // namespace
+
+// Adds workers when they join the arena of the thread which created the observer
+struct HwCounters::Observer : private AttachedArena, public tbb::task_scheduler_observer {
+    explicit Observer(HwCounters& hwCounters) : tbb::task_scheduler_observer(arena), counters(hwCounters) {
+        observe(true);
+    }
+
+    ~Observer() override {
+        // waits for callbacks in progress
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        counters.addCurrentThread();
+    }
+
+    HwCounters& counters;
+};
+#else
+struct HwCounters::Observer {};
+#endif
+
+HwCounters::HwCounters(std::size_t maxThreads) : capacity(maxThreads), threads(new ThreadCounters[maxThreads]) {}
+
+HwCounters::~HwCounters() {
+    observer.reset();
+#ifdef __linux__
+    const auto num = threadsNum.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < num; i++) {
+        if (threads[i].groupFd >= 0)
+            close(threads[i].groupFd);
+    }
+#endif
+}
+
+bool HwCounters::contains(std::thread::id id) const {
+    const auto num = threadsNum.load(std::memory_order_acquire);
+    return std::any_of(threads.get(), threads.get() + num, [&](const ThreadCounters& thread) { return thread.id == id; });
+}
+
+void HwCounters::addCurrentThread() {
+    const auto id = std::this_thread::get_id();
+    // threads re-enter arenas often, so the common case doesn't take the lock
+    if (contains(id))
+        return;
+
+    std::lock_guard<std::mutex> lock(addMutex);
+    const auto num = threadsNum.load(std::memory_order_relaxed);
+    if (num == capacity || contains(id))
+        return;
+
+#ifdef __linux__
+    // failed attempt is remembered too, so it is not repeated on every inference
+    threads[num] = {id, openHwEventsGroup()};
+#else
+    threads[num] = {id, -1};
+#endif
+    threadsNum.store(num + 1, std::memory_order_release);
+}
+
+void HwCounters::addCurrentStreamThreads() {
+    addCurrentThread();
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (!observer)
+        observer.reset(new Observer(*this));
+#elif IE_THREAD == IE_THREAD_OMP
+    // the team of the calling thread is reused by its parallel regions
+    InferenceEngine::parallel_nt(0, [&](const int, const int) {
+        addCurrentThread();
+    });
+#endif
+}
+
+HwCounterValues HwCounters::read() const {
+    HwCounterValues res;
+
+#ifdef __linux__
+    struct {
+        uint64_t nr;
+        uint64_t values[hwEventsNum];
+    } data;
+
+    const auto num = threadsNum.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < num; i++) {
+        const auto groupFd = threads[i].groupFd;
+        if (groupFd < 0)
+            continue;
+        if (::read(groupFd, &data, sizeof(data)) != sizeof(data) || data.nr != hwEventsNum)
+            continue;
+
+        res.cycles += data.values[0];
+        res.instructions += data.values[1];
+        res.llcMisses += data.values[2];
+    }
+#endif
+
+    return res;
+}
+
+}  // namespace MKLDNNPlugin
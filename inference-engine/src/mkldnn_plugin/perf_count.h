@@ -4,32 +4,124 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace MKLDNNPlugin {
 
+struct HwCounterValues {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+
+    HwCounterValues& operator+=(const HwCounterValues& other) {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llcMisses += other.llcMisses;
+        return *this;
+    }
+};
+
+/**
+ * Hardware performance counters (cycles, instructions, LLC misses) of a set of threads.
+ * Counters are opened with Linux perf_event_open for each thread which joins the set,
+ * read() returns the sum over all of them. On other systems or if the kernel refuses
+ * to open counters (see /proc/sys/kernel/perf_event_paranoid) all values are zero.
+ *
+ * Counters of a thread count everything it runs. If several streams execute in parallel, or a TBB worker
+ * moves to the arena of another stream, the values of a primitive include work of other streams as well.
+ */
+class HwCounters {
+public:
+    typedef std::shared_ptr<HwCounters> Ptr;
+
+    // Threads joining after the set is full are not counted
+    explicit HwCounters(std::size_t maxThreads);
+    HwCounters(const HwCounters&) = delete;
+    HwCounters& operator=(const HwCounters&) = delete;
+    ~HwCounters();
+
+    // Opens counters for the calling thread if it has not joined yet
+    void addCurrentThread();
+
+    /**
+     * Adds the calling thread and the threads executing its parallel regions.
+     * With TBB workers are added by an observer when they join the current arena, so it is enough to call it once.
+     */
+    void addCurrentStreamThreads();
+
+    // Doesn't take locks, so it may be called concurrently with threads joining the set
+    HwCounterValues read() const;
+
+private:
+    struct ThreadCounters {
+        std::thread::id id;
+        int groupFd;
+    };
+
+    struct Observer;
+
+    bool contains(std::thread::id id) const;
+
+    const std::size_t capacity;
+    std::unique_ptr<ThreadCounters[]> threads;
+    // Threads are only appended, the slots below threadsNum are immutable
+    std::atomic<std::size_t> threadsNum {0};
+    std::mutex addMutex;
+    std::unique_ptr<Observer> observer;
+};
+
 class PerfCount {
     uint64_t duration;
     uint32_t num;
+    HwCounterValues hwTotal;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
+    HwCounterValues __hwStart;
 
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+
+    double avgNs() const { return (num == 0) ? 0.0 : static_cast<double>(duration) / num; }
+
+    HwCounterValues avgHw() const {
+        HwCounterValues res;
+        if (num != 0) {
+            res.cycles = hwTotal.cycles / num;
+            res.instructions = hwTotal.instructions / num;
+            res.llcMisses = hwTotal.llcMisses / num;
+        }
+        return res;
+    }
 
 private:
-    void start_itr() {
+    void start_itr(const HwCounters* hw) {
+        if (hw)
+            __hwStart = hw->read();
         __start = std::chrono::high_resolution_clock::now();
     }
 
-    void finish_itr() {
+    void finish_itr(const HwCounters* hw) {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
         num++;
+
+        if (hw) {
+            // threads never leave the set, so the sums don't decrease
+            const auto hwFinish = hw->read();
+            hwTotal.cycles += hwFinish.cycles - __hwStart.cycles;
+            hwTotal.instructions += hwFinish.instructions - __hwStart.instructions;
+            hwTotal.llcMisses += hwFinish.llcMisses - __hwStart.llcMisses;
+        }
     }
 
     friend class PerfHelper;
@@ -37,13 +129,17 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    const HwCounters* hw;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, const HwCounters* hwCounters = nullptr): counter(count), hw(hwCounters) {
+        counter.start_itr(hw);
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() { counter.finish_itr(hw); }
 };
 
 }  // namespace MKLDNNPlugin
 
 #define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF_HW(_counter, _hw) PerfHelper __helper##__counter (_counter->PerfCounter(), _hw);
@@ -11,6 +11,7 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_internal.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
+#include <ie_tracer.hpp>
 
 #include <exception>
 #include <future>
@@ -307,7 +308,10 @@ private:
             try {
                 auto& stageTask = std::get<Stage_e::task>(thisStage);
                 IE_ASSERT(nullptr != stageTask);
-                stageTask();
+                {
+                    IE_TRACE_SCOPE("PipelineStage", "request");
+                    stageTask();
+                }
                if (itEndStage != itNextStage) {
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
@@ -330,6 +334,7 @@ private:
                         if (nullptr != callback) {
                             InferenceEngine::CurrentException() = localCurrentException;
                             try {
+                                IE_TRACE_SCOPE("Callback", "request");
                                 callback(_publicInterface, requestStatus);
                             } catch (...) {
                                 localCurrentException = std::current_exception();
@@ -48,6 +48,33 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @brief Used to get an average number of CPU cycles spent by the executable primitive.
+ */
+static const char HW_CYCLES[] = "hwCycles";
+
+/**
+ * @brief Used to get an average number of instructions retired by the executable primitive.
+ */
+static const char HW_INSTRUCTIONS[] = "hwInstructions";
+
+/**
+ * @brief Used to get an average number of last level cache misses of the executable primitive.
+ */
+static const char HW_LLC_MISSES[] = "hwLlcMisses";
+
+/**
+ * @brief Used to get an achieved performance of the executable primitive in GFLOPS
+ *        based on an estimated number of floating point operations.
+ */
+static const char ESTIMATED_GFLOPS[] = "estimatedGFlops";
+
+/**
+ * @brief Used to get an achieved memory bandwidth of the executable primitive in GB/s
+ *        based on an estimated size of its inputs, outputs and weights.
+ */
+static const char ESTIMATED_GBPS[] = "estimatedGBps";
+
 /**
  * @brief Used to get output layouts of primitive.
  */
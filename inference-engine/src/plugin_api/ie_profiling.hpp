@@ -21,6 +21,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include "ie_tracer.hpp"
+
 #ifdef ENABLE_PROFILING_ITT
 #include <ittnotify.h>
 #endif
@@ -156,7 +158,8 @@ static void annotateEnd(IttStatic&, IttProfilingTask& t);
 /**
  * @class ProfilingTask
  * @ingroup ie_dev_profiling
- * @brief Used to annotate section of code which would be named at runtime
+ * @brief Used to annotate section of code which would be named at runtime.
+ *        Sections are also recorded by the built-in tracer, see ie_tracer.hpp
  */
 struct ProfilingTask {
     ProfilingTask() = default;
@@ -169,7 +172,8 @@ struct ProfilingTask {
     * @brief Construct ProfilingTask with runtime defined name
     */
     inline explicit ProfilingTask(const std::string& taskName)
-        : name(taskName)
+        : name(taskName),
+          _traceName(internTraceName(taskName))
 #ifdef ENABLE_PROFILING_ITT
           ,
           domain(__itt_domain_create("InferenceEngine")),
@@ -178,11 +182,19 @@ struct ProfilingTask {
     {
     }
 
+    /**
+    * @brief Returns name of the task used by the tracer, `nullptr` for unnamed task
+    */
+    const char* traceName() const noexcept {
+        return _traceName;
+    }
+
 private:
     friend void annotateBegin(IttStatic&, IttProfilingTask& t);
     friend void annotateEnd(IttStatic&, IttProfilingTask& t);
 
     std::string name;
+    const char* _traceName = nullptr;
 #ifdef ENABLE_PROFILING_ITT
     __itt_domain* domain;
     __itt_string_handle* handle;
@@ -246,6 +258,8 @@ inline static void annotateSetThreadName(const char* name) {
  *        ProfilingTask::name will be used as section id.
  * @param PROFILING_TASK variable of ProfilingTask type
  */
-#define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) IE_ITT_TASK_SCOPE(PROFILING_TASK);
+#define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) \
+    IE_ITT_TASK_SCOPE(PROFILING_TASK);                \
+    IE_TRACE_SCOPE((PROFILING_TASK).traceName(), "task");
 
 }  // namespace InferenceEngine
@@ -0,0 +1,127 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines API of built-in tracer which records timeline of inference as Chrome trace JSON
+ * @file ie_tracer.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Checks whether tracing is enabled. The check is cheap, so it can be done in hot paths.
+ * @ingroup    ie_dev_profiling
+ * @return     `True` if tracing is enabled, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) isTracingEnabled() noexcept;
+
+/**
+ * @brief      Enables tracing or disables it if @p traceFile is empty.
+ *             Events recorded so far are written to the previous trace file before it is changed.
+ *             The trace is also written at process exit if tracing is still enabled.
+ * @ingroup    ie_dev_profiling
+ * @param[in]  traceFile  Path to Chrome trace JSON file
+ */
+INFERENCE_ENGINE_API_CPP(void) setTraceFile(const std::string& traceFile);
+
+/**
+ * @brief      Returns a pointer to a copy of @p name which is valid till the process exit.
+ *             Trace events keep only pointers to names, so names known at runtime must be interned.
+ *             Interned names are never released, so their number is limited. Once the limit is reached,
+ *             new names are replaced with a common placeholder name.
+ * @ingroup    ie_dev_profiling
+ * @param[in]  name  Event name
+ * @return     Pointer to the interned name
+ */
+INFERENCE_ENGINE_API_CPP(const char*) internTraceName(const std::string& name);
+
+/**
+ * @brief      Sets name of the current thread shown in the trace
+ * @ingroup    ie_dev_profiling
+ * @param[in]  name  Thread name
+ */
+INFERENCE_ENGINE_API_CPP(void) setTraceThreadName(const std::string& name);
+
+/**
+ * @brief      Records an event which took place on the current thread. Doesn't take locks.
+ * @ingroup    ie_dev_profiling
+ * @param[in]  name      Interned or string literal name of the event
+ * @param[in]  category  String literal category of the event
+ * @param[in]  begin     Begin timestamp, see traceTimestamp()
+ * @param[in]  end       End timestamp, instant event is recorded if it is equal to @p begin
+ */
+INFERENCE_ENGINE_API_CPP(void) traceEvent(const char* name, const char* category,
+                                          std::uint64_t begin, std::uint64_t end) noexcept;
+
+/**
+ * @brief      Returns timestamp of trace events in nanoseconds
+ * @ingroup    ie_dev_profiling
+ */
+inline std::uint64_t traceTimestamp() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief      Records an instant event if tracing is enabled
+ * @ingroup    ie_dev_profiling
+ */
+inline void traceInstant(const char* name, const char* category) noexcept {
+    if (name != nullptr && isTracingEnabled()) {
+        const auto timestamp = traceTimestamp();
+        traceEvent(name, category, timestamp, timestamp);
+    }
+}
+
+/**
+ * @class      TraceScope
+ * @ingroup    ie_dev_profiling
+ * @brief      Records an event lasting till scope exit if tracing is enabled at scope entry
+ */
+class TraceScope {
+public:
+    TraceScope(const char* name, const char* category) noexcept
+        : _name {name != nullptr && isTracingEnabled() ? name : nullptr}, _category {category} {
+        if (_name != nullptr) {
+            _begin = traceTimestamp();
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() {
+        if (_name != nullptr) {
+            traceEvent(_name, _category, _begin, traceTimestamp());
+        }
+    }
+
+private:
+    const char* _name;
+    const char* _category;
+    std::uint64_t _begin = 0;
+};
+
+}  // namespace InferenceEngine
+
+#define IE_TRACE_CONCAT(x, y) IE_TRACE_CONCAT_EVAL(x, y)
+#define IE_TRACE_CONCAT_EVAL(x, y) x##y
+
+/**
+ * @def IE_TRACE_SCOPE(NAME, CATEGORY)
+ * @ingroup ie_dev_profiling
+ * @brief Records section of code till scope exit in the trace if tracing is enabled
+ * @param NAME Interned or string literal name of the section
+ * @param CATEGORY String literal category of the section
+ */
+#define IE_TRACE_SCOPE(NAME, CATEGORY) \
+    ::InferenceEngine::TraceScope IE_TRACE_CONCAT(ieTraceScope, __LINE__) {NAME, CATEGORY}
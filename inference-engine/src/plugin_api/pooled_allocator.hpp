@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines the default allocator of Inference Engine blobs and its statistics
+ * @file pooled_allocator.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "ie_api.h"
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Snapshot of the pooled allocator counters
+ */
+struct PooledAllocatorStatistics {
+    size_t allocations = 0;        //!< Number of successful alloc() calls
+    size_t deallocations = 0;      //!< Number of free() calls with non-null handle
+    size_t poolHits = 0;           //!< Number of allocations served from thread or global caches
+    size_t bytesInUse = 0;         //!< Bytes (rounded to size classes) currently owned by blobs
+    size_t bytesCached = 0;        //!< Bytes kept in the global cache for reuse
+    size_t bytesThreadCached = 0;  //!< Bytes kept in caches of all threads for reuse
+};
+
+/**
+ * @brief Default allocator of Inference Engine blobs.
+ *
+ * Requests are rounded up to size classes (four classes per power of two, up to 64MB) and freed
+ * blocks are kept in per-thread caches for small classes and in a bounded global cache for large ones,
+ * so re-creating blobs of the same size does not hit the system allocator. Each thread cache is bounded
+ * and is moved to the global cache when its thread exits. Bigger requests are served by the system
+ * directly. On Linux blocks of 2MB and more are mapped with transparent huge pages advice.
+ * Returned memory is aligned to 64 bytes.
+ *
+ * All instances share the same pool, the only one in a process, so the object itself is lightweight.
+ */
+class INFERENCE_ENGINE_API_CLASS(PooledMemoryAllocator) : public IAllocator {
+public:
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Returns current values of the process-wide allocation counters
+     * @return A snapshot of the counters
+     */
+    static PooledAllocatorStatistics getStatistics() noexcept;
+
+    /**
+     * @brief Returns the memory kept in the global cache and in the calling thread cache to the system.
+     * Caches of other threads are released on their next allocation or deallocation, or at thread exit.
+     */
+    static void trim() noexcept;
+};
+
+}  // namespace InferenceEngine
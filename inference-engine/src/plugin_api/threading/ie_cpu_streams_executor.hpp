@@ -44,8 +44,26 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Runs the task by the stream with index @p streamIndex only.
+     *        Tasks pinned to a stream are taken by it before the tasks of the common queue.
+     * @param task A task to start
+     * @param streamIndex An index of the stream in range [0, Config::_streams)
+     */
+    void run(Task task, int streamIndex);
+
     void Execute(Task task) override;
 
+    /**
+     * @brief Executes the task in the current thread within the task arena of the stream with index @p streamIndex.
+     *        Waits till the stream finishes its current task, the stream doesn't take new tasks until the call returns.
+     *        So the task may use resources owned by the stream without waking up the stream thread.
+     *        With OpenMP the task uses the number of threads of the stream, the current thread's one is restored after.
+     * @param task A task to start
+     * @param streamIndex An index of the stream in range [0, Config::_streams)
+     */
+    void Execute(Task task, int streamIndex);
+
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
@@ -75,6 +75,7 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _spinWaitTime            = 0;  //!< Time in microseconds stream threads poll for new tasks before they sleep. Zero disables polling
 
         /**
          * @brief      A constructor with arguments
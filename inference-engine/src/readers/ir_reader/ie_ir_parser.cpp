@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <deque>
 #include <map>
+#include <exception>
 #include <memory>
 #include <ngraph/ngraph.hpp>
 #include <set>
@@ -32,6 +33,7 @@
 #include "generic_ie.hpp"
 #include "precision_utils.h"
 #include "blob_factory.hpp"
+#include "ie_parallel.hpp"
 
 using namespace InferenceEngine;
 using namespace XMLParseUtils;
@@ -92,16 +94,39 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     std::vector<size_t> outputs;
     std::unordered_set<std::string> opName;
 
-    // Read all layers and store their parameters in params map
+    // Generic parameters of layers are independent from each other, so string to number conversion
+    // of ports and dimensions is done in parallel. pugixml DOM is safe for concurrent read-only access.
+    std::vector<pugi::xml_node> layerNodes;
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layerNodes.push_back(node);
+    }
+    std::vector<GenericLayerParams> layerParams(layerNodes.size());
+    std::vector<std::exception_ptr> exceptions(layerNodes.size());
+    parallel_for(layerNodes.size(), [&](size_t i) {
+        try {
+            layerParams[i] = parseGenericParams(layerNodes[i]);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    });
+    // Rethrow the first error in the IR order to keep error messages deterministic
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    // Store layers parameters in params map
+    for (size_t i = 0; i < layerNodes.size(); i++) {
+        const auto& node = layerNodes[i];
+        auto& node_param = layerParams[i];
         if (opName.find(node_param.name) != opName.end())
             THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        const size_t layerId = node_param.layerId;
+        params[layerId] = {node, std::move(node_param)};
     }
 
     using edge = struct { size_t fromLayerId, fromPortId, toPortId; };
@@ -366,6 +391,14 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
         std::make_shared<LayerCreator<ngraph::op::v1::ReduceLogicalAnd>>("ReduceLogicalAnd"),
         std::make_shared<LayerCreator<ngraph::op::v1::ReduceLogicalOr>>("ReduceLogicalOr"),
     };
+    // Index creators by type once instead of the caseless linear search for every layer
+    static const details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> creatorsByType = [] {
+        details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> index;
+        for (const auto& creator : creators) {
+            index.emplace(creator->getType(), creator);
+        }
+        return index;
+    }();
 
     // Check that operation in default opsets
     auto isDefaultOpSet = [](const std::string& version) -> bool {
@@ -389,27 +422,27 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
     std::shared_ptr<ngraph::Node> ngraphNode;
     if (isDefaultOpSet(params.version)) {
         // Try to create operation from creators
-        for (const auto& creator : creators) {
-            if (creator->shouldCreate(params.type)) {
-                bool useCreator = false;
-                // Check that opset is registered
-                useCreator |= opsets.find(params.version) == opsets.end();
-                if (!useCreator) {
-                    // Check that creator can create operation with the version from opset
-                    const auto opset = opsets.at(params.version);
-                    // Opset should contains the same version of operation or doesn't contain operation with current type
-                    useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
-                }
-                if (useCreator)
-                    ngraphNode = creator->createLayer(inputs, node, binStream, params);
-                break;
+        auto creatorIt = creatorsByType.find(params.type);
+        if (creatorIt != creatorsByType.end()) {
+            const auto& creator = creatorIt->second;
+            bool useCreator = false;
+            // Check that opset is registered
+            auto opsetIt = opsets.find(params.version);
+            useCreator |= opsetIt == opsets.end();
+            if (!useCreator) {
+                // Check that creator can create operation with the version from opset
+                const auto& opset = opsetIt->second;
+                // Opset should contains the same version of operation or doesn't contain operation with current type
+                useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
             }
+            if (useCreator)
+                ngraphNode = creator->createLayer(inputs, node, binStream, params);
         }
     }
 
     // Try to create operation from loaded opsets
     if (!ngraphNode && opsets.count(params.version)) {
-        auto opset = opsets.at(params.version);
+        const auto& opset = opsets.at(params.version);
 
         if (!opset.contains_type(params.type)) {
             THROW_IE_EXCEPTION << "Opset " << params.version << " doesn't contain the operation with type: " << params.type;
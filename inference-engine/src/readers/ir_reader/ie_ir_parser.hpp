@@ -99,9 +99,6 @@ private:
 
     protected:
         explicit LayerBaseCreator(const std::string& type): type(type) {}
-        std::string getType() {
-            return type;
-        }
         template <class T>
         std::vector<T> getParameters(const pugi::xml_node& node, const std::string& name) {
             std::vector<T> result;
@@ -147,6 +144,9 @@ private:
                                                           const GenericLayerParams& layerParsePrms) = 0;
 
         bool shouldCreate(const std::string& nodeType) const;
+        const std::string& getType() const {
+            return type;
+        }
         virtual ngraph::NodeTypeInfo getNodeType() const = 0;
     };
 
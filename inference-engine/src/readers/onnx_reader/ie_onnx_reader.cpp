@@ -5,9 +5,19 @@
 #include "ie_onnx_reader.hpp"
 #include <ie_api.h>
 #include <ngraph/frontend/onnx_import/onnx.hpp>
+#include <string>
 
 using namespace InferenceEngine;
 
+namespace {
+
+std::string readPathFromStream(std::istream& stream) {
+    const auto path = static_cast<const std::string*>(stream.pword(getModelPathStreamIndex()));
+    return path ? *path : std::string{};
+}
+
+}  // namespace
+
 bool ONNXReader::supportModel(std::istream& model) const {
     model.seekg(0, model.beg);
     const int header_size = 128;
@@ -22,7 +32,8 @@ bool ONNXReader::supportModel(std::istream& model) const {
 }
 
 CNNNetwork ONNXReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
-    return CNNNetwork(ngraph::onnx_import::import_onnx_model(model));
+    // Path is needed to load tensors stored in external data files
+    return CNNNetwork(ngraph::onnx_import::import_onnx_model(model, readPathFromStream(model)));
 }
 
 INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
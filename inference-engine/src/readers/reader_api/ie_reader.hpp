@@ -51,6 +51,15 @@ public:
     virtual std::vector<std::string> getDataFileExtensions() const = 0;
 };
 
+/**
+ * @brief Returns index of the model stream storage (see std::ios_base::pword) which keeps a pointer
+ * to the path of the model file (std::string). Readers use it to find files which the model refers to.
+ * The pointer is null if the model isn't read from a file.
+ *
+ * @return Index of the storage
+ */
+INFERENCE_ENGINE_API_CPP(int) getModelPathStreamIndex();
+
 /**
  * @brief Creates the default instance of the reader
  *
@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+
+/// \brief Operator computing Softmax(scale * Q x K^T + mask) x V over the last two dimensions.
+class TRANSFORMATIONS_API ScaledDotProductAttentionIE : public Op {
+public:
+    static constexpr NodeTypeInfo type_info{"ScaledDotProductAttentionIE", 1};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+    ScaledDotProductAttentionIE() = default;
+    /// \param query        Tensor of shape [..., Q_LEN, HEAD_SIZE]
+    /// \param key          Tensor of shape [..., KV_LEN, HEAD_SIZE] or [..., HEAD_SIZE, KV_LEN]
+    ///                     if transpose_key is false
+    /// \param value        Tensor of shape [..., KV_LEN, VALUE_SIZE]
+    /// \param mask         Tensor numpy-broadcastable to [..., Q_LEN, KV_LEN] added to scaled scores
+    /// \param scale        Multiplier of Q x K^T
+    /// \param transpose_key Whether key is stored as [..., KV_LEN, HEAD_SIZE]
+    ScaledDotProductAttentionIE(const Output<Node>& query,
+                                const Output<Node>& key,
+                                const Output<Node>& value,
+                                float scale,
+                                bool transpose_key);
+
+    ScaledDotProductAttentionIE(const Output<Node>& query,
+                                const Output<Node>& key,
+                                const Output<Node>& value,
+                                const Output<Node>& mask,
+                                float scale,
+                                bool transpose_key);
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_key() const { return m_transpose_key; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_key = true;
+};
+
+}  // namespace op
+}  // namespace ngraph
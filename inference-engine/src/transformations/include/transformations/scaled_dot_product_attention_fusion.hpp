@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include "transformations/utils/pass_param.hpp"
+
+namespace ngraph {
+namespace pass {
+
+    class TRANSFORMATIONS_API ScaledDotProductAttentionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ScaledDotProductAttentionFusion transformation detects
+ * MatMul(Q, K) -> [Multiply/Divide by scalar] -> [Add(mask)] -> Softmax -> MatMul(V) pattern
+ * and fuses it into a single ScaledDotProductAttentionIE operation.
+ *
+ * ScaledDotProductAttentionFusion transformation is not a part of common optimizations, plugins which
+ * support ScaledDotProductAttentionIE run it explicitly. The fused operation is passed to the callback
+ * set with setCallback method and the fusion is skipped if the callback returns true.
+ * See the example below.
+ *
+ * Callback example:
+ *
+ *     // This callback skips ScaledDotProductAttentionFusion transformation for non FP32 graphs
+ *     auto callback = [](const std::shared_ptr<const ngraph::Node> & node) -> bool {
+ *         auto attention = std::dynamic_pointer_cast<const ngraph::op::ScaledDotProductAttentionIE>(node);
+ *         return attention && attention->get_output_element_type(0) != ngraph::element::f32;
+ *     };
+ *
+ *     auto p = ngraph::pass::ScaledDotProductAttentionFusion();
+ *     p.setCallback(callback);
+ *     p.run_on_function(f);
+ *
+ */
+class ngraph::pass::ScaledDotProductAttentionFusion: public ngraph::pass::GraphRewrite, public ngraph::pass::PassParam {
+public:
+    ScaledDotProductAttentionFusion() : GraphRewrite(), PassParam() {
+        scaled_dot_product_attention_fusion();
+    }
+
+private:
+    void scaled_dot_product_attention_fusion();
+};
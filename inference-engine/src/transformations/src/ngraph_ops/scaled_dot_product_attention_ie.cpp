@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_ops/scaled_dot_product_attention_ie.hpp"
+
+#include <memory>
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ScaledDotProductAttentionIE::type_info;
+
+op::ScaledDotProductAttentionIE::ScaledDotProductAttentionIE(const Output<Node>& query,
+                                                             const Output<Node>& key,
+                                                             const Output<Node>& value,
+                                                             float scale,
+                                                             bool transpose_key)
+        : Op({query, key, value}), m_scale(scale), m_transpose_key(transpose_key) {
+    constructor_validate_and_infer_types();
+}
+
+op::ScaledDotProductAttentionIE::ScaledDotProductAttentionIE(const Output<Node>& query,
+                                                             const Output<Node>& key,
+                                                             const Output<Node>& value,
+                                                             const Output<Node>& mask,
+                                                             float scale,
+                                                             bool transpose_key)
+        : Op({query, key, value, mask}), m_scale(scale), m_transpose_key(transpose_key) {
+    constructor_validate_and_infer_types();
+}
+
+shared_ptr<Node> op::ScaledDotProductAttentionIE::copy_with_new_args(const NodeVector& new_args) const {
+    if (new_args.size() == 3) {
+        return make_shared<ScaledDotProductAttentionIE>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                        m_scale, m_transpose_key);
+    }
+    check_new_args_count(this, new_args);
+    return make_shared<ScaledDotProductAttentionIE>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                    m_scale, m_transpose_key);
+}
+
+void op::ScaledDotProductAttentionIE::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 3 || get_input_size() == 4,
+                          "Expected 3 or 4 inputs, got: ", get_input_size());
+
+    const auto& query_shape = get_input_partial_shape(0);
+    const auto& key_shape = get_input_partial_shape(1);
+    const auto& value_shape = get_input_partial_shape(2);
+    const auto& data_et = get_input_element_type(0);
+
+    if (query_shape.is_dynamic() || key_shape.is_dynamic() || value_shape.is_dynamic()) {
+        set_output_type(0, data_et, PartialShape::dynamic());
+        return;
+    }
+
+    const auto query = query_shape.to_shape();
+    const auto key = key_shape.to_shape();
+    const auto value = value_shape.to_shape();
+    const size_t rank = query.size();
+
+    NODE_VALIDATION_CHECK(this, rank >= 2 && key.size() == rank && value.size() == rank,
+                          "Query, key and value must have equal rank >= 2");
+    for (size_t i = 0; i + 2 < rank; i++) {
+        NODE_VALIDATION_CHECK(this, query[i] == key[i] && query[i] == value[i],
+                              "Query, key and value must have equal batch dimensions");
+    }
+
+    const size_t head_size = query[rank - 1];
+    const size_t key_head_size = m_transpose_key ? key[rank - 1] : key[rank - 2];
+    const size_t kv_len = m_transpose_key ? key[rank - 2] : key[rank - 1];
+    NODE_VALIDATION_CHECK(this, head_size == key_head_size, "Query and key have different head sizes");
+    NODE_VALIDATION_CHECK(this, kv_len == value[rank - 2], "Key and value have different lengths");
+
+    Shape output_shape = query;
+    output_shape[rank - 1] = value[rank - 1];
+    set_output_type(0, data_et, output_shape);
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/scaled_dot_product_attention_fusion.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include "ngraph_ops/scaled_dot_product_attention_ie.hpp"
+
+namespace {
+
+bool has_single_consumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+bool get_scalar_value(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1) {
+        return false;
+    }
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// Mask is added to scores, so it has to be broadcastable to the scores shape without changing it
+bool is_valid_mask(const ngraph::Shape& mask_shape, const ngraph::Shape& scores_shape) {
+    if (mask_shape.size() > scores_shape.size()) {
+        return false;
+    }
+    const size_t offset = scores_shape.size() - mask_shape.size();
+    for (size_t i = 0; i < mask_shape.size(); i++) {
+        if (mask_shape[i] != 1 && mask_shape[i] != scores_shape[offset + i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+void ngraph::pass::ScaledDotProductAttentionFusion::scaled_dot_product_attention_fusion() {
+    auto probs = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1});
+    auto value = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1});
+    auto matmul_v = std::make_shared<ngraph::opset1::MatMul>(probs, value);
+
+    ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+        auto matmul_v = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul_v || matmul_v->get_transpose_a() || matmul_v->get_transpose_b()) {
+            return false;
+        }
+
+        NodeVector fused_nodes{matmul_v};
+
+        auto softmax = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(matmul_v->input_value(0).get_node_shared_ptr());
+        if (!softmax || !has_single_consumer(softmax)) {
+            return false;
+        }
+        fused_nodes.push_back(softmax);
+
+        auto scores_shape = softmax->get_input_partial_shape(0);
+        if (scores_shape.is_dynamic() || scores_shape.rank().get_length() < 2 ||
+            softmax->get_axis() != static_cast<size_t>(scores_shape.rank().get_length() - 1)) {
+            return false;
+        }
+
+        auto current = softmax->input_value(0).get_node_shared_ptr();
+
+        Output<Node> mask;
+        if (auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(current)) {
+            if (!has_single_consumer(add) || add->get_autob().m_type != op::AutoBroadcastType::NUMPY) {
+                return false;
+            }
+            // Mask may come as any of Add inputs, scores are the one produced by the rest of the pattern
+            size_t scores_idx = 0;
+            auto producer = add->input_value(0).get_node_shared_ptr();
+            if (!std::dynamic_pointer_cast<ngraph::opset1::MatMul>(producer) &&
+                !std::dynamic_pointer_cast<ngraph::opset1::Multiply>(producer) &&
+                !std::dynamic_pointer_cast<ngraph::opset1::Divide>(producer)) {
+                scores_idx = 1;
+            }
+            mask = add->input_value(1 - scores_idx);
+            if (mask.get_partial_shape().is_dynamic() ||
+                !is_valid_mask(mask.get_shape(), scores_shape.to_shape()) ||
+                add->get_input_partial_shape(scores_idx) != scores_shape) {
+                return false;
+            }
+            fused_nodes.push_back(add);
+            current = add->input_value(scores_idx).get_node_shared_ptr();
+        }
+
+        float scale = 1.f;
+        if (auto multiply = std::dynamic_pointer_cast<ngraph::opset1::Multiply>(current)) {
+            size_t scores_idx = 0;
+            if (get_scalar_value(multiply->input_value(1), scale)) {
+                scores_idx = 0;
+            } else if (get_scalar_value(multiply->input_value(0), scale)) {
+                scores_idx = 1;
+            } else {
+                return false;
+            }
+            if (!has_single_consumer(multiply) || multiply->get_input_partial_shape(scores_idx) != scores_shape) {
+                return false;
+            }
+            fused_nodes.push_back(multiply);
+            current = multiply->input_value(scores_idx).get_node_shared_ptr();
+        } else if (auto divide = std::dynamic_pointer_cast<ngraph::opset1::Divide>(current)) {
+            float divisor = 0.f;
+            if (!has_single_consumer(divide) || !get_scalar_value(divide->input_value(1), divisor) || divisor == 0.f ||
+                divide->get_input_partial_shape(0) != scores_shape) {
+                return false;
+            }
+            scale = 1.f / divisor;
+            fused_nodes.push_back(divide);
+            current = divide->input_value(0).get_node_shared_ptr();
+        }
+
+        auto matmul_qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(current);
+        if (!matmul_qk || !has_single_consumer(matmul_qk) || matmul_qk->get_transpose_a()) {
+            return false;
+        }
+        fused_nodes.push_back(matmul_qk);
+
+        auto query = matmul_qk->input_value(0);
+        auto key = matmul_qk->input_value(1);
+        auto value = matmul_v->input_value(1);
+        const auto& element_type = query.get_element_type();
+        if (!element_type.is_real() || key.get_element_type() != element_type || value.get_element_type() != element_type ||
+            query.get_partial_shape().is_dynamic() || key.get_partial_shape().is_dynamic() ||
+            value.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+
+        // MatMul allows batch broadcasting and 1D inputs, the fused operation expects equal ranks and batches
+        const auto query_shape = query.get_shape();
+        const auto key_shape = key.get_shape();
+        const auto value_shape = value.get_shape();
+        const size_t rank = query_shape.size();
+        if (rank < 2 || key_shape.size() != rank || value_shape.size() != rank ||
+            scores_shape.rank().get_length() != static_cast<int64_t>(rank)) {
+            return false;
+        }
+        for (size_t i = 0; i + 2 < rank; i++) {
+            if (query_shape[i] != key_shape[i] || query_shape[i] != value_shape[i]) {
+                return false;
+            }
+        }
+
+        std::shared_ptr<ngraph::Node> attention;
+        if (mask.get_node()) {
+            attention = std::make_shared<ngraph::op::ScaledDotProductAttentionIE>(query, key, value, mask, scale,
+                                                                                  matmul_qk->get_transpose_b());
+        } else {
+            attention = std::make_shared<ngraph::op::ScaledDotProductAttentionIE>(query, key, value, scale,
+                                                                                  matmul_qk->get_transpose_b());
+        }
+        attention->set_friendly_name(matmul_v->get_friendly_name());
+        ngraph::copy_runtime_info(fused_nodes, attention);
+
+        if (transformation_callback(attention)) {
+            return false;
+        }
+
+        ngraph::replace_node(matmul_v, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_v, "ScaledDotProductAttentionFusion");
+    this->add_matcher(m, callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
@@ -107,6 +107,7 @@ struct CompilationConfig final {
     bool enableReplaceWithReduceMean = true;
     bool enableTensorIteratorUnrolling = false;
     bool forcePureTensorIterator = false;
+    bool enableLifetimeAllocation = false;
 
     //
     // Deprecated options
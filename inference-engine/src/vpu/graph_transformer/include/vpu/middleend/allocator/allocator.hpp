@@ -14,6 +14,7 @@
 #include <vpu/model/edges.hpp>
 #include <vpu/middleend/allocator/structs.hpp>
 #include <vpu/middleend/allocator/shaves.hpp>
+#include <vpu/middleend/allocator/lifetime_planner.hpp>
 
 namespace vpu {
 
@@ -98,6 +99,17 @@ public:
 
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
+    /**
+     * Re-places intermediate data in DDR using lifetimes collected during the current allocation,
+     * the new placement is applied only if it requires less memory
+     */
+    void packDataInDDR();
+
+    /**
+     * Compares used memory with the lower bound given by lifetimes of intermediate data
+     */
+    allocator::MemoryReport memoryReport(MemoryType memType) const;
+
 private:
     allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
     void freeMem(allocator::MemChunk* chunk);
@@ -110,6 +122,8 @@ private:
     std::size_t freeDDRMemoryAmount() const;
     std::size_t freeCMXMemoryAmount() const;
 
+    std::vector<allocator::Lifetime> collectLifetimes(Location location, DataVector* datas = nullptr) const;
+
 private:
     int _modelBatchSize = 1;
 
@@ -126,6 +140,12 @@ private:
 
     DataMap<allocator::MemChunk*> _memChunksPerData;
 
+    /**
+     * Lifetimes of intermediate data measured in allocation and deallocation events
+     */
+    int _curEvent = 0;
+    DataMap<allocator::Lifetime> _lifetimes;
+
     int _blobMemOffset = 0;
     int _inputMemOffset = 0;
     int _outputMemOffset = 0;
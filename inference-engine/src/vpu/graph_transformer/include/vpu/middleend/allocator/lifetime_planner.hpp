@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+namespace vpu {
+
+namespace allocator {
+
+//
+// Lifetime
+//
+
+//
+// Buffer which is alive in [begin, end) range of allocator events.
+// Buffers with intersecting ranges must not share memory.
+//
+
+struct Lifetime final {
+    int begin = 0;
+    int end = 0;
+    int size = 0;
+    int offset = -1;
+};
+
+inline bool intersects(const Lifetime& lhs, const Lifetime& rhs) {
+    return lhs.begin < rhs.end && rhs.begin < lhs.end;
+}
+
+//
+// MemoryReport
+//
+
+struct MemoryReport final {
+    // Memory used by the allocation
+    int used = 0;
+    // Maximal total size of simultaneously alive buffers, no allocation can use less memory
+    int lowerBound = 0;
+
+    // Fraction of used memory which is not occupied at the peak point
+    double fragmentation() const {
+        return used > 0 ? static_cast<double>(used - lowerBound) / used : 0.0;
+    }
+};
+
+//
+// Lifetime planner
+//
+
+//
+// Assigns offsets to all buffers solving placement for the whole lifetime graph at once:
+// buffers are placed in order of decreasing size, each one into the tightest gap
+// between already placed buffers which intersect it by lifetime.
+// Returns the total memory size required by the placement.
+//
+
+int planLifetimes(std::vector<Lifetime>& lifetimes);
+
+int lifetimesLowerBound(const std::vector<Lifetime>& lifetimes);
+
+}  // namespace allocator
+
+}  // namespace vpu
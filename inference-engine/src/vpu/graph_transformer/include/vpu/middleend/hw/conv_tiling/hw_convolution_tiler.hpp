@@ -7,6 +7,7 @@
 #include <utility>
 #include <memory>
 #include <list>
+#include <map>
 #include <string>
 #include <limits>
 #include <algorithm>
@@ -131,6 +132,31 @@ public:
 
 class HWConvolutionTileLayoutCut;
 
+// Tiling options depend on convolution parameters only, so convolutions with the same parameters
+// share the search results within a model
+class HWConvolutionTilingCache final {
+public:
+    explicit HWConvolutionTilingCache(int numCMXSlices) : _numCMXSlices(numCMXSlices) {}
+
+    // Searches for tiling options of all convolutions which are not in the cache yet, in parallel
+    void search(const std::vector<ConvolutionOptions>& convolutionOptions, const Direction& direction,
+                std::size_t maxTilingOptions);
+
+    const std::vector<TilingOption>& tilingOptions(const ConvolutionOptions& convolutionOptions,
+                                                   const Direction& direction, std::size_t maxTilingOptions);
+
+    std::size_t size() const { return _tilingOptions.size(); }
+
+private:
+    using Key = std::vector<int>;
+
+    static Key makeKey(const ConvolutionOptions& convolutionOptions, const Direction& direction,
+                       std::size_t maxTilingOptions);
+
+    const int _numCMXSlices;
+    std::map<Key, std::vector<TilingOption>> _tilingOptions;
+};
+
 // iterates over all the tiling options and chooses few with minimal cost
 class HWConvolutionTilingSearcher {
 public:
@@ -142,13 +168,16 @@ public:
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
         _tilingOptions(other._tilingOptions) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                std::size_t maxTilingOptions) :
+                                std::size_t maxTilingOptions, HWConvolutionTilingCache* cache = nullptr) :
         _convolutionOptions(std::move(convolutionOptions)),
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = cache != nullptr
+                ? cache->tilingOptions(_convolutionOptions, direction, maxTilingOptions)
+                : selectBetterTiling(_convolutionOptions, *_dirTiling, maxTilingOptions,
+                                     CompileEnv::get().resources.numCMXSlices);
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
@@ -159,8 +188,13 @@ public:
 
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
+    // Doesn't depend on CompileEnv, so may be called from any thread
+    static std::vector<TilingOption> selectBetterTiling(const ConvolutionOptions& convolutionOptions,
+                                                        GraphDataTiling& dirTiling,
+                                                        std::size_t maxTilingOptions,
+                                                        int numCMXSlices);
+
 private:
-    std::vector<TilingOption> selectBetterTiling() const;
 
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
@@ -173,7 +207,8 @@ class HWConvolutionTiler final {
 public:
     HWConvolutionTiler() = delete;
     HWConvolutionTiler(const HWConvolutionTiler&) = default;
-    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions);
+    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions,
+                       HWConvolutionTilingCache* cache = nullptr);
 
 
     bool isTilingPossible() const {
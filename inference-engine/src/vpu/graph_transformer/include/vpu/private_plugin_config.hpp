@@ -84,6 +84,13 @@ DECLARE_VPU_CONFIG_KEY(ENABLE_TENSOR_ITERATOR_UNROLLING);
  */
 DECLARE_VPU_CONFIG_KEY(FORCE_PURE_TENSOR_ITERATOR);
 
+/**
+ * @brief Used to re-place intermediate data in DDR after allocation using lifetimes of all data at once,
+ * which reduces BSS size when greedy allocation leaves memory fragmented.
+ * Default is "NO".
+ */
+DECLARE_VPU_CONFIG_KEY(ENABLE_LIFETIME_ALLOCATION);
+
 //
 // Myriad plugin options
 //
@@ -293,6 +293,12 @@ bool Allocator::allocateData(const Data& data) {
     _memChunksPerData.emplace(data, chunk);
     _allocatedIntermData.emplace(data);
 
+    allocator::Lifetime lifetime;
+    lifetime.begin = _curEvent++;
+    lifetime.end = std::numeric_limits<int>::max();
+    lifetime.size = finalByteSize;
+    _lifetimes[data] = lifetime;
+
     return chunk->memType == memoryType;
 }
 
@@ -365,6 +371,8 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
 
             _memChunksPerData.erase(parent);
             _allocatedIntermData.erase(parent);
+
+            _lifetimes.at(parent).end = _curEvent++;
         }
     };
 
@@ -473,6 +481,61 @@ std::size_t Allocator::freeMemoryAmount(const MemoryType& type) const {
     return type == MemoryType::CMX ? freeCMXMemoryAmount() : freeDDRMemoryAmount();
 }
 
+std::vector<allocator::Lifetime> Allocator::collectLifetimes(Location location, DataVector* datas) const {
+    DataVector located;
+    for (const auto& p : _lifetimes) {
+        if (p.first->dataLocation().location == location) {
+            located.emplace_back(p.first);
+        }
+    }
+
+    // Events are unique, so the order doesn't depend on the hash map
+    std::sort(located.begin(), located.end(), [this](const Data& lhs, const Data& rhs) {
+        return _lifetimes.at(lhs).begin < _lifetimes.at(rhs).begin;
+    });
+
+    std::vector<allocator::Lifetime> lifetimes;
+    lifetimes.reserve(located.size());
+    for (const auto& data : located) {
+        auto lifetime = _lifetimes.at(data);
+        // Data which is still allocated lives till the end of the allocation
+        lifetime.end = std::min(lifetime.end, _curEvent);
+        lifetime.offset = data->dataLocation().offset;
+        lifetimes.emplace_back(lifetime);
+    }
+
+    if (datas != nullptr) {
+        *datas = std::move(located);
+    }
+
+    return lifetimes;
+}
+
+void Allocator::packDataInDDR() {
+    DataVector datas;
+    auto lifetimes = collectLifetimes(Location::BSS, &datas);
+
+    const auto packedSize = allocator::planLifetimes(lifetimes);
+    if (packedSize >= _ddrMemoryPool.memUsed) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < datas.size(); ++i) {
+        datas[i]->setDataAllocationInfo({Location::BSS, lifetimes[i].offset});
+        updateChildDataAllocation(datas[i], DDR_MAX_SIZE);
+    }
+
+    _ddrMemoryPool.memUsed = packedSize;
+}
+
+allocator::MemoryReport Allocator::memoryReport(MemoryType memType) const {
+    allocator::MemoryReport report;
+    report.used = _memPools.at(memType)->memUsed;
+    report.lowerBound = allocator::lifetimesLowerBound(
+        collectLifetimes(memType == MemoryType::CMX ? Location::CMX : Location::BSS));
+    return report;
+}
+
 void Allocator::extractDatas(MemoryType memType, const DataSet& from, DataVector& out) const {
     for (const auto& data : from) {
         if (data->usage() != DataUsage::Intermediate)
@@ -678,6 +741,9 @@ void Allocator::reset() {
     _allocatedIntermData.clear();
 
     _memChunksPerData.clear();
+
+    _curEvent = 0;
+    _lifetimes.clear();
 }
 
 AllocationResult Allocator::preprocess(const Model& model) {
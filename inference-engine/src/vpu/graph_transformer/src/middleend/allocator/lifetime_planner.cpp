@@ -0,0 +1,98 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/allocator/lifetime_planner.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <vpu/utils/error.hpp>
+
+namespace vpu {
+
+namespace allocator {
+
+int planLifetimes(std::vector<Lifetime>& lifetimes) {
+    std::vector<std::size_t> order(lifetimes.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    // Large buffers are the hardest to fit, so they are placed first, ties are resolved by lifetime start
+    // to keep the result independent of the input order
+    std::stable_sort(order.begin(), order.end(), [&lifetimes](std::size_t lhs, std::size_t rhs) {
+        const auto& l = lifetimes[lhs];
+        const auto& r = lifetimes[rhs];
+        return l.size != r.size ? l.size > r.size : l.begin < r.begin;
+    });
+
+    std::vector<const Lifetime*> placed;
+    placed.reserve(lifetimes.size());
+
+    std::vector<std::pair<int, int>> busy;
+
+    int totalSize = 0;
+
+    for (auto ind : order) {
+        auto& lifetime = lifetimes[ind];
+        VPU_THROW_UNLESS(lifetime.begin < lifetime.end && lifetime.size >= 0,
+            "Invalid lifetime [{}, {}) of buffer with size {}", lifetime.begin, lifetime.end, lifetime.size);
+
+        busy.clear();
+        for (const auto& other : placed) {
+            if (intersects(lifetime, *other)) {
+                busy.emplace_back(other->offset, other->offset + other->size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        //
+        // Find the tightest gap between busy ranges, the space after the last one is used if nothing fits
+        //
+
+        int bestOffset = -1;
+        int bestGap = std::numeric_limits<int>::max();
+
+        int prevEnd = 0;
+        for (const auto& range : busy) {
+            const auto gap = range.first - prevEnd;
+            if (gap >= lifetime.size && gap < bestGap) {
+                bestGap = gap;
+                bestOffset = prevEnd;
+            }
+            prevEnd = std::max(prevEnd, range.second);
+        }
+
+        lifetime.offset = bestOffset >= 0 ? bestOffset : prevEnd;
+        totalSize = std::max(totalSize, lifetime.offset + lifetime.size);
+
+        placed.emplace_back(&lifetime);
+    }
+
+    return totalSize;
+}
+
+int lifetimesLowerBound(const std::vector<Lifetime>& lifetimes) {
+    // Sweep over lifetime borders, frees go before allocations at the same point
+    std::map<int, int> deltas;
+    for (const auto& lifetime : lifetimes) {
+        deltas[lifetime.begin] += lifetime.size;
+        deltas[lifetime.end] -= lifetime.size;
+    }
+
+    int alive = 0;
+    int maxAlive = 0;
+    for (const auto& delta : deltas) {
+        alive += delta.second;
+        maxAlive = std::max(maxAlive, alive);
+    }
+
+    return maxAlive;
+}
+
+}  // namespace allocator
+
+}  // namespace vpu
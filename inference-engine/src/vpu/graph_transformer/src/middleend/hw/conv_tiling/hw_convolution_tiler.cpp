@@ -9,6 +9,8 @@
 #include <utility>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 
+#include <ie_parallel.hpp>
+
 namespace vpu {
 
 namespace HWTilingNS {
@@ -257,9 +259,9 @@ public:
 };
 
 HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                       std::size_t maxTilingOptions) :
+                                       std::size_t maxTilingOptions, HWConvolutionTilingCache* cache) :
     _convolutionOptions(std::move(convolutionOptions)),
-    _searcher(_convolutionOptions, direction, maxTilingOptions) {
+    _searcher(_convolutionOptions, direction, maxTilingOptions, cache) {
     _tilingPossible = tileForHW();
 }
 
@@ -617,23 +619,23 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
-std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
-    auto& dirTiling = *_dirTiling;
-    FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
+std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling(const ConvolutionOptions& convolutionOptions,
+                                                                          GraphDataTiling& dirTiling,
+                                                                          std::size_t maxTilingOptions,
+                                                                          int numCMXSlices) {
+    FixedMaxHeap<TilingOption> tilingOptions(maxTilingOptions);
 
     // TODO: estimate this numbers
     const int maxNumWidthTiles = 15;
     const int maxNumHeightTiles = 15;
-    const int maxNumChannelTiles = _convolutionOptions._withPool ? 1 : 15;
+    const int maxNumChannelTiles = convolutionOptions._withPool ? 1 : 15;
 
     const auto outputTileInitial = dirTiling.getOutputTileDims();
     const auto inputTileInitial = dirTiling.getInputTileDims();
 
     auto minInputTileDimW = 64;
-    auto minInputTileDimH = _convolutionOptions._kernelSizeY;
-    if (_convolutionOptions._withPool) {
+    auto minInputTileDimH = convolutionOptions._kernelSizeY;
+    if (convolutionOptions._withPool) {
         minInputTileDimW *= 2;
         minInputTileDimH *= 2;
     }
@@ -641,11 +643,27 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
 
-    const auto cmxLimit = tilingCMXLimit(env.resources.numCMXSlices);
+    const auto cmxLimit = tilingCMXLimit(numCMXSlices);
+
+    // SoC overhead is added for every output element, output tiles cover the whole output at least
+    const double minSoCOverheadPerTile = static_cast<double>(convolutionOptions._outputDims[Dim::W])
+                                         * convolutionOptions._outputDims[Dim::H]
+                                         * outputTileInitial[Dim::C];
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
-        const int tileSizeDimC = divUp(_convolutionOptions._inputDims[Dim::C], numChannelTiles);
+        //
+        // The lower bound of cost grows with the number of channel tiles, so once it exceeds
+        // the cost of all collected options, the rest of options can't get to the result.
+        //
+
+        const double minCost = (numChannelTiles - 1) * minSoCOverheadPerTile;
+        if (tilingOptions.size() == maxTilingOptions &&
+            minCost > tilingOptions.front().cost && !isDoubleEqual(minCost, tilingOptions.front().cost)) {
+            break;
+        }
+
+        const int tileSizeDimC = divUp(convolutionOptions._inputDims[Dim::C], numChannelTiles);
 
         // here split and iterate either over input tensors or over output tensors depending on the direction.
         for (int numWidthTiles = 1; numWidthTiles <= maxNumWidthTiles; numWidthTiles++) {
@@ -657,7 +675,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
             if (numWidthTiles > 1 && direction == Direction::INPUT_TO_OUTPUT) {
                 tileSizeDimW = divUp(tileSizeDimW,
-                                     _convolutionOptions._kernelStride) * _convolutionOptions._kernelStride;
+                                     convolutionOptions._kernelStride) * convolutionOptions._kernelStride;
 
                 if (tileSizeDimW < minInputTileDimW) {
                     break;
@@ -672,15 +690,15 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                 //
                 if (numHeightTiles > 1 && direction == Direction::INPUT_TO_OUTPUT) {
                     tileSizeDimH = divUp(tileSizeDimH,
-                                         _convolutionOptions._kernelStride) * _convolutionOptions._kernelStride;
+                                         convolutionOptions._kernelStride) * convolutionOptions._kernelStride;
 
                     updateInputTileSize(tileSizeDimH,
                                         numHeightTiles,
-                                        _convolutionOptions._outputDims[Dim::H],
-                                        _convolutionOptions._kernelSizeY,
-                                        _convolutionOptions._kernelStride,
-                                        _convolutionOptions._paddingBottom,
-                                        _convolutionOptions._paddingTop,
+                                        convolutionOptions._outputDims[Dim::H],
+                                        convolutionOptions._kernelSizeY,
+                                        convolutionOptions._kernelStride,
+                                        convolutionOptions._paddingBottom,
+                                        convolutionOptions._paddingTop,
                                         false);  // do not use ceil
 
                     if (tileSizeDimH < minInputTileDimH) {
@@ -701,7 +719,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                 // Limitations for Conv+Pool case.
                 //
 
-                if (_convolutionOptions._withPool) {
+                if (convolutionOptions._withPool) {
                     if (dirTiling.getOutputTileDims()[Dim::W] <= 2 || dirTiling.getOutputTileDims()[Dim::H] <= 2) {
                         break;
                     }
@@ -713,10 +731,10 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
                 // TODO: check internal in/out hardcodes
                 const auto heightTiles = calcHeightTiles(
-                    _convolutionOptions, dirTiling.getOutputTileDims(),
+                    convolutionOptions, dirTiling.getOutputTileDims(),
                     dirTiling.useCeil());
                 const auto widthTiles = calcWidthTiles(
-                    _convolutionOptions, dirTiling.getOutputTileDims(),
+                    convolutionOptions, dirTiling.getOutputTileDims(),
                     dirTiling.useCeil());
 
                 if (heightTiles.empty()) {
@@ -735,7 +753,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                         // Limitations for Conv+Pool case.
                         //
 
-                        if (_convolutionOptions._withPool) {
+                        if (convolutionOptions._withPool) {
                             if (widthTile.inputWithJunk % 2 != 0 || heightTile.inputWithJunk % 2 != 0 ||
                                 widthTile.outputWithJunk % 2 != 0 || widthTile.outputWithJunk <= 2 ||
                                 heightTile.outputWithJunk <= 2 ||
@@ -759,9 +777,9 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                         const auto tileInfo = splitHwConvIntoOutChannelsTiles(  // left asis, not new ver in new api
                             widthTile.inputWithJunk, heightTile.inputWithJunk, tileSizeDimC,
                             outputTileInitial[Dim::C],
-                            _convolutionOptions._kernelSizeX,
-                            _convolutionOptions._kernelSizeY,
-                            _convolutionOptions._kernelStride);
+                            convolutionOptions._kernelSizeX,
+                            convolutionOptions._kernelSizeY,
+                            convolutionOptions._kernelStride);
 
                         if (tileInfo.numDescr == 0) {
                             isOK = false;
@@ -842,6 +860,76 @@ HWConvolutionTileLayoutCut HWConvolutionTilingSearcher::tileLayoutCut(const Tili
     return HWConvolutionTileLayoutCut(*_dirTiling, option);
 }
 
+HWConvolutionTilingCache::Key HWConvolutionTilingCache::makeKey(const ConvolutionOptions& convolutionOptions,
+                                                                const Direction& direction,
+                                                                std::size_t maxTilingOptions) {
+    Key key;
+    for (const auto* dims : {&convolutionOptions._inputDims,
+                             &convolutionOptions._outputDims,
+                             &convolutionOptions._origOutputDims}) {
+        for (const auto& dim : *dims) {
+            key.push_back(static_cast<int>(dim.first));
+            key.push_back(dim.second);
+        }
+        key.push_back(-1);
+    }
+
+    key.insert(key.end(), {
+        convolutionOptions._kernelSizeX,
+        convolutionOptions._kernelSizeY,
+        convolutionOptions._kernelStride,
+        convolutionOptions._paddingLeft,
+        convolutionOptions._paddingRight,
+        convolutionOptions._paddingTop,
+        convolutionOptions._paddingBottom,
+        convolutionOptions._withPool,
+        static_cast<int>(direction),
+        static_cast<int>(maxTilingOptions)});
+
+    return key;
+}
+
+void HWConvolutionTilingCache::search(const std::vector<ConvolutionOptions>& convolutionOptions,
+                                      const Direction& direction, std::size_t maxTilingOptions) {
+    std::vector<Key> keys;
+    std::vector<const ConvolutionOptions*> toSearch;
+    for (const auto& options : convolutionOptions) {
+        auto key = makeKey(options, direction, maxTilingOptions);
+        if (_tilingOptions.count(key) != 0 || std::find(keys.begin(), keys.end(), key) != keys.end()) {
+            continue;
+        }
+        keys.push_back(std::move(key));
+        toSearch.push_back(&options);
+    }
+
+    std::vector<std::vector<TilingOption>> results(toSearch.size());
+    ie::parallel_for(static_cast<int>(toSearch.size()), [&](int ind) {
+        auto dirTiling = ConvGraphDataTilingFactory::makeDirTiling(*toSearch[ind], direction);
+        dirTiling->initTileSizes();
+        results[ind] = HWConvolutionTilingSearcher::selectBetterTiling(
+            *toSearch[ind], *dirTiling, maxTilingOptions, _numCMXSlices);
+    });
+
+    for (std::size_t ind = 0; ind < keys.size(); ++ind) {
+        _tilingOptions.emplace(std::move(keys[ind]), std::move(results[ind]));
+    }
+}
+
+const std::vector<TilingOption>& HWConvolutionTilingCache::tilingOptions(const ConvolutionOptions& convolutionOptions,
+                                                                         const Direction& direction,
+                                                                         std::size_t maxTilingOptions) {
+    auto key = makeKey(convolutionOptions, direction, maxTilingOptions);
+    auto it = _tilingOptions.find(key);
+    if (it == _tilingOptions.end()) {
+        auto dirTiling = ConvGraphDataTilingFactory::makeDirTiling(convolutionOptions, direction);
+        dirTiling->initTileSizes();
+        auto options = HWConvolutionTilingSearcher::selectBetterTiling(
+            convolutionOptions, *dirTiling, maxTilingOptions, _numCMXSlices);
+        it = _tilingOptions.emplace(std::move(key), std::move(options)).first;
+    }
+    return it->second;
+}
+
 std::ostream& operator<<(std::ostream& stream, const TilingOption& tilingOption) {
     stream << "WHC: "
            << tilingOption.numWidthTiles << "x"
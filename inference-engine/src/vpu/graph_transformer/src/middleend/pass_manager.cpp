@@ -4,10 +4,13 @@
 
 #include <vpu/middleend/pass_manager.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 
@@ -39,6 +42,9 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    std::vector<std::pair<double, std::string>> durations;
+    durations.reserve(_passes.size());
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -52,15 +58,43 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        durations.emplace_back(duration, p.second);
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    //
+    // Compile time breakdown, the most expensive passes go first
+    //
+
+    if (env.log->isActive(LogLevel::Info)) {
+        double totalDuration = 0.0;
+        for (const auto& duration : durations) {
+            totalDuration += duration.first;
+        }
+
+        std::stable_sort(durations.begin(), durations.end(),
+            [](const std::pair<double, std::string>& lhs, const std::pair<double, std::string>& rhs) {
+                return lhs.first > rhs.first;
+            });
+
+        env.log->info("MiddleEnd : passes duration : %f ms", totalDuration);
+        VPU_LOGGER_SECTION(env.log);
+
+        for (const auto& duration : durations) {
+            env.log->info("%f ms (%f %%) [%s]",
+                          duration.first, totalDuration > 0.0 ? 100.0 * duration.first / totalDuration : 0.0,
+                          duration.second);
+        }
+    }
 }
 
 //
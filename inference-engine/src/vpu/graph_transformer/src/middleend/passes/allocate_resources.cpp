@@ -28,6 +28,8 @@ namespace vpu {
 AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableShapeAllocation, CheckOnlyCMX checkOnlyCmx) {
     VPU_PROFILE(runAllocator);
 
+    const auto& env = CompileEnv::get();
+
     auto& allocator = model->getAllocator();
 
     //
@@ -201,6 +203,14 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
         }
     }
 
+    //
+    // Re-place DDR data based on lifetimes of all datas.
+    //
+
+    if (checkOnlyCmx == CheckOnlyCMX::NO && env.config.enableLifetimeAllocation) {
+        allocator.packDataInDDR();
+    }
+
     //
     // Allocate shape for all datas
     //
@@ -249,6 +259,18 @@ void PassImpl::run(const Model& model) {
     //
 
     model->attrs().set<UsedMemory>("usedMemory", allocator.usedMemoryAmount());
+
+    const auto& env = CompileEnv::get();
+    if (env.log->isActive(LogLevel::Info)) {
+        const auto printReport = [&env, &allocator](const char* name, MemoryType memType) {
+            const auto report = allocator.memoryReport(memType);
+            env.log->info("%s : used %d bytes, lower bound %d bytes, fragmentation %f %%",
+                          name, report.used, report.lowerBound, report.fragmentation() * 100.0);
+        };
+
+        printReport("BSS", MemoryType::DDR);
+        printReport("CMX", MemoryType::CMX);
+    }
 }
 
 }  // namespace
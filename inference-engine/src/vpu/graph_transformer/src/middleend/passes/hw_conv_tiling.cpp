@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,16 +32,61 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+bool isHWConvStage(const Stage& stage) {
+    return stage->type() == StageType::StubConv && stage->attrs().getOrDefault<bool>("tryHW", false);
+}
+
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage,
+                                                      const HWConvStageOptions& stageOptions,
+                                                      const HWConvStageIO& stageIO) {
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
-    for (const auto& origStage : model->getStages()) {
-        if (origStage->type() != StageType::StubConv) {
-            continue;
+    const auto& env = CompileEnv::get();
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    //
+    // Search for tilings of all convolutions in advance, it is the most expensive part of the pass.
+    // Convolutions with the same parameters share the result.
+    //
+
+    HWTilingNS::HWConvolutionTilingCache tilingCache(env.resources.numCMXSlices);
+    {
+        std::vector<HWTilingNS::ConvolutionOptions> allConvolutionOptions;
+        for (const auto& origStage : model->getStages()) {
+            if (isHWConvStage(origStage)) {
+                allConvolutionOptions.push_back(makeConvolutionOptions(
+                    origStage, HWConvStageOptions(origStage), HWConvStageIO(origStage, origStage->output(0))));
+            }
         }
 
-        const auto tryHW = origStage->attrs().getOrDefault<bool>("tryHW", false);
-        if (!tryHW) {
+        tilingCache.search(allConvolutionOptions, direction, tilingsCount);
+
+        env.log->trace("HW convolution tiling : %d stages, %d unique configurations",
+                       allConvolutionOptions.size(), tilingCache.size());
+    }
+
+    for (const auto& origStage : model->getStages()) {
+        if (!isHWConvStage(origStage)) {
             continue;
         }
 
@@ -55,26 +101,9 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
+        const auto convolutionOptions = makeConvolutionOptions(origStage, stageOptions, stageIO);
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount, &tilingCache);
 
 
         const HWTilingNS::HWConvolutionTiler& tiler = [&] {
@@ -94,7 +123,7 @@ void PassImpl::run(const Model& model) {
                     false
                 };
 
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
+                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount, &tilingCache};
             } else {
                 return tiler1stAttempt;
             }
@@ -61,6 +61,7 @@ IE_SUPPRESS_DEPRECATED_START
         VPU_CONFIG_KEY(ENABLE_REPLACE_WITH_REDUCE_MEAN),
         VPU_CONFIG_KEY(ENABLE_TENSOR_ITERATOR_UNROLLING),
         VPU_CONFIG_KEY(FORCE_PURE_TENSOR_ITERATOR),
+        VPU_CONFIG_KEY(ENABLE_LIFETIME_ALLOCATION),
         VPU_CONFIG_KEY(DISABLE_CONVERT_STAGES),
 
         //
@@ -167,6 +168,7 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.enableReplaceWithReduceMean,    switches, config, VPU_CONFIG_KEY(ENABLE_REPLACE_WITH_REDUCE_MEAN));
     setOption(_compileConfig.enableTensorIteratorUnrolling,  switches, config, VPU_CONFIG_KEY(ENABLE_TENSOR_ITERATOR_UNROLLING));
     setOption(_compileConfig.forcePureTensorIterator,        switches, config, VPU_CONFIG_KEY(FORCE_PURE_TENSOR_ITERATOR));
+    setOption(_compileConfig.enableLifetimeAllocation,       switches, config, VPU_CONFIG_KEY(ENABLE_LIFETIME_ALLOCATION));
     setOption(_compileConfig.disableConvertStages,           switches, config, VPU_CONFIG_KEY(DISABLE_CONVERT_STAGES));
 
     setOption(_compileConfig.irWithVpuScalesDir, config, VPU_CONFIG_KEY(IR_WITH_SCALES_DIRECTORY));
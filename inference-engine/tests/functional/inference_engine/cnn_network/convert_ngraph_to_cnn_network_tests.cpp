@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <convert_function_to_cnn_network.hpp>
 #include <cpp/ie_cnn_network.h>
 
@@ -65,3 +67,75 @@ TEST(ConvertFunctionToCNNNetworkTests, ConvertConvolutionNetwork) {
         FAIL();
     }
 }
+
+TEST(ConvertFunctionToCNNNetworkTests, ConvertLargeNetworkSharesConstants) {
+    const size_t layersNum = 2000;
+    std::shared_ptr<ngraph::Function> f;
+    std::vector<std::shared_ptr<ngraph::opset1::Constant>> constants;
+    {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        std::shared_ptr<ngraph::Node> last = param;
+        for (size_t i = 0; i < layersNum; i++) {
+            auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 16},
+                                                             std::vector<float>(16, static_cast<float>(i)));
+            constant->set_friendly_name("const_" + std::to_string(i));
+            constants.push_back(constant);
+            last = std::make_shared<ngraph::opset1::Add>(last, constant);
+            last->set_friendly_name("add_" + std::to_string(i));
+        }
+        auto result = std::make_shared<ngraph::op::Result>(last);
+
+        f = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+    }
+
+    InferenceEngine::CNNNetwork nGraphImpl(f);
+    auto net = InferenceEngine::details::convertFunctionToICNNNetwork(f, nGraphImpl);
+
+    ASSERT_EQ(1 + 2 * layersNum, net->layerCount());
+    for (size_t i = 0; i < layersNum; i++) {
+        CNNLayerPtr constLayer;
+        ASSERT_EQ(OK, net->getLayerByName(("const_" + std::to_string(i)).c_str(), constLayer, nullptr));
+        ASSERT_EQ(constants[i]->get_data_ptr(), constLayer->blobs["custom"]->cbuffer().as<const void *>());
+
+        CNNLayerPtr addLayer;
+        ASSERT_EQ(OK, net->getLayerByName(("add_" + std::to_string(i)).c_str(), addLayer, nullptr));
+        ASSERT_EQ(2, addLayer->insData.size());
+        ASSERT_EQ(constLayer, getCreatorLayer(addLayer->insData[1].lock()).lock());
+    }
+}
+
+TEST(ConvertFunctionToCNNNetworkTests, ConvertNetworkWithConstantSharedByManyLayers) {
+    const size_t layersNum = 2000;
+    std::shared_ptr<ngraph::Function> f;
+    {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        // The constant has no friendly name, so its unique name is generated on the first request
+        auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 16},
+                                                         std::vector<float>(16, 1.f));
+        ngraph::ResultVector results;
+        for (size_t i = 0; i < layersNum; i++) {
+            auto add = std::make_shared<ngraph::opset1::Add>(param, constant);
+            add->set_friendly_name("add_" + std::to_string(i));
+            results.push_back(std::make_shared<ngraph::op::Result>(add));
+        }
+
+        f = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{param});
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+    }
+
+    InferenceEngine::CNNNetwork nGraphImpl(f);
+    auto net = InferenceEngine::details::convertFunctionToICNNNetwork(f, nGraphImpl);
+
+    CNNLayerPtr constLayer;
+    for (size_t i = 0; i < layersNum; i++) {
+        CNNLayerPtr addLayer;
+        ASSERT_EQ(OK, net->getLayerByName(("add_" + std::to_string(i)).c_str(), addLayer, nullptr));
+        ASSERT_EQ(2, addLayer->insData.size());
+        auto creator = getCreatorLayer(addLayer->insData[1].lock()).lock();
+        ASSERT_NE(nullptr, creator);
+        if (!constLayer) constLayer = creator;
+        ASSERT_EQ(constLayer, creator);
+    }
+    ASSERT_EQ("Const", constLayer->type);
+}
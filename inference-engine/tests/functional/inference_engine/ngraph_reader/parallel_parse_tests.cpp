@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "ngraph_reader_tests.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+namespace {
+
+constexpr size_t activationsNum = 64;
+
+std::string port(size_t id, const std::string& lastDim = "22") {
+    return "<port id=\"" + std::to_string(id) + "\" precision=\"FP32\">"
+           "<dim>1</dim><dim>3</dim><dim>22</dim><dim>" + lastDim + "</dim></port>";
+}
+
+// Parameter followed by a chain of ReLU and Sigmoid layers, the layers are written in the reverse order,
+// so the IR order differs from both the layer ids and the topological order.
+// Layers found in badDims get the given value as the last dimension of their output port.
+std::string makeChainModel(const std::map<size_t, std::string>& badDims = {}) {
+    std::vector<std::string> layers;
+    layers.push_back("<layer name=\"in1\" type=\"Parameter\" id=\"0\" version=\"opset1\">"
+                     "<data element_type=\"f32\" shape=\"1,3,22,22\"/><output>" + port(0) + "</output></layer>");
+    for (size_t id = 1; id <= activationsNum; id++) {
+        const auto bad = badDims.find(id);
+        const std::string type = id % 2 ? "ReLU" : "Sigmoid";
+        layers.push_back("<layer name=\"activation" + std::to_string(id) + "\" type=\"" + type + "\" id=\"" + std::to_string(id) +
+                         "\" version=\"opset1\"><input>" + port(0) + "</input><output>" +
+                         port(1, bad == badDims.end() ? "22" : bad->second) + "</output></layer>");
+    }
+    layers.push_back("<layer name=\"output\" type=\"Result\" id=\"" + std::to_string(activationsNum + 1) +
+                     "\" version=\"opset1\"><input>" + port(0) + "</input></layer>");
+
+    std::string model = "<net name=\"Network\" version=\"10\"><layers>";
+    for (auto layer = layers.rbegin(); layer != layers.rend(); ++layer)
+        model += *layer;
+    model += "</layers><edges>";
+    for (size_t id = 1; id <= activationsNum + 1; id++) {
+        model += "<edge from-layer=\"" + std::to_string(id - 1) + "\" from-port=\"" + (id == 1 ? "0" : "1") +
+                 "\" to-layer=\"" + std::to_string(id) + "\" to-port=\"0\"/>";
+    }
+    model += "</edges></net>";
+    return model;
+}
+
+}  // namespace
+
+TEST_F(NGraphReaderTests, ReadLongChainMatchesReferenceFunction) {
+    Core ie;
+    Blob::Ptr weights;
+    auto network = ie.ReadNetwork(makeChainModel(), weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    std::shared_ptr<ngraph::Function> reference;
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        std::shared_ptr<ngraph::Node> last = input;
+        for (size_t id = 1; id <= activationsNum; id++) {
+            if (id % 2)
+                last = std::make_shared<ngraph::opset1::Relu>(last);
+            else
+                last = std::make_shared<ngraph::opset1::Sigmoid>(last);
+        }
+        reference = std::make_shared<ngraph::Function>(ngraph::NodeVector{last}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(function, reference);
+    ASSERT_TRUE(res.first) << res.second;
+
+    // Parameters parsed by different threads must stay attached to their own layers
+    std::vector<std::string> names;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (op->is_parameter() || op->is_output())
+            continue;
+        names.push_back(op->get_friendly_name());
+    }
+    ASSERT_EQ(activationsNum, names.size());
+    for (size_t id = 1; id <= activationsNum; id++)
+        ASSERT_EQ("activation" + std::to_string(id), names[id - 1]);
+}
+
+TEST_F(NGraphReaderTests, ReadNetworkWithTwoMalformedLayersReportsFirstInIROrder) {
+    // Layers are written in the reverse order, so activation50 precedes activation3 in the IR
+    const auto model = makeChainModel({{3, "x"}, {50, "0"}});
+
+    // Layers are parsed in parallel, errors must not depend on which one is found first
+    for (int i = 0; i < 10; i++) {
+        Core ie;
+        Blob::Ptr weights;
+        try {
+            ie.ReadNetwork(model, weights);
+            FAIL() << "Malformed IR was read";
+        } catch (const InferenceEngine::details::InferenceEngineException& e) {
+            const std::string message = e.what();
+            ASSERT_NE(std::string::npos, message.find("dimension (0)")) << message;
+            ASSERT_EQ(std::string::npos, message.find("dimension (x)")) << message;
+        }
+    }
+}
@@ -3,9 +3,11 @@
 //
 
 #include <gtest/gtest.h>
+#include <cstdio>
 #include <set>
 #include <string>
 #include <fstream>
+#include <vector>
 
 #include <ie_blob.h>
 #include <ie_core.hpp>
@@ -134,3 +136,143 @@ opset_import {
     ASSERT_EQ(count_parameters, 1);
 }
 
+
+namespace {
+
+// Initializers A and B are stored in a separate file, B starts at an offset which isn't aligned
+const std::string externalDataModel = R"V0G0N(
+ir_version: 3
+producer_name: "nGraph ONNX Importer"
+graph {
+  node {
+    input: "A"
+    input: "B"
+    output: "X"
+    name: "add_node1"
+    op_type: "Add"
+  }
+  node {
+    input: "X"
+    input: "C"
+    output: "Y"
+    name: "add_node2"
+    op_type: "Add"
+  }
+  name: "test_graph"
+  initializer {
+    dims: 2
+    dims: 2
+    data_type: 1
+    name: "A"
+    external_data {
+      key: "location"
+      value: "_LOCATION_"
+    }
+    external_data {
+      key: "length"
+      value: "16"
+    }
+    data_location: EXTERNAL
+  }
+  initializer {
+    dims: 2
+    dims: 2
+    data_type: 1
+    name: "B"
+    external_data {
+      key: "location"
+      value: "_LOCATION_"
+    }
+    external_data {
+      key: "offset"
+      value: "20"
+    }
+    data_location: EXTERNAL
+  }
+  input {
+    name: "C"
+    type {
+      tensor_type {
+        elem_type: 1
+        shape {
+          dim {
+            dim_value: 2
+          }
+          dim {
+            dim_value: 2
+          }
+        }
+      }
+    }
+  }
+  output {
+    name: "Y"
+    type {
+      tensor_type {
+        elem_type: 1
+        shape {
+          dim {
+            dim_value: 2
+          }
+          dim {
+            dim_value: 2
+          }
+        }
+      }
+    }
+  }
+}
+opset_import {
+  version: 4
+}
+)V0G0N";
+
+class ONNX_Reader_External_Data_Tests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::vector<float> a = {1, 2, 3, 4}, padding = {0}, b = {5, 6, 7, 8};
+        std::ofstream data(dataPath, std::ios::binary);
+        for (const auto& values : {a, padding, b})
+            data.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+    }
+
+    void TearDown() override {
+        std::remove(modelPath.c_str());
+        std::remove(dataPath.c_str());
+    }
+
+    void writeModel(const std::string& location) {
+        std::string model = externalDataModel;
+        for (auto pos = model.find("_LOCATION_"); pos != std::string::npos; pos = model.find("_LOCATION_"))
+            model.replace(pos, std::string("_LOCATION_").size(), location);
+        std::ofstream(modelPath) << model;
+    }
+
+    const std::string modelPath = "onnx_external_data_model.prototxt";
+    const std::string dataPath = "onnx_external_data_model.data";
+};
+
+}  // namespace
+
+// The reader gets the model path from ReadNetwork, otherwise the data location can't be resolved
+TEST_F(ONNX_Reader_External_Data_Tests, ReadNetworkLoadsExternalData) {
+    writeModel(dataPath);
+
+    InferenceEngine::Core ie;
+    auto function = ie.ReadNetwork(modelPath).getFunction();
+
+    std::set<std::vector<float>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op))
+            constants.insert(constant->cast_vector<float>());
+    }
+    ASSERT_EQ(constants, (std::set<std::vector<float>>{{1, 2, 3, 4}, {5, 6, 7, 8}}));
+}
+
+TEST_F(ONNX_Reader_External_Data_Tests, ReadNetworkRejectsLocationOutsideOfModelDir) {
+    InferenceEngine::Core ie;
+    for (const auto& location : {"../" + dataPath, "data/../../" + dataPath, "/tmp/" + dataPath}) {
+        writeModel(location);
+        ASSERT_ANY_THROW(ie.ReadNetwork(modelPath)) << location;
+    }
+}
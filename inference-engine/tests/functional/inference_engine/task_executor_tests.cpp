@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <iostream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -185,6 +189,160 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+static IStreamsExecutor::Config spinningExecutorConfig(int streams) {
+    IStreamsExecutor::Config config{"TestSpinningCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._spinWaitTime = 100;
+    return config;
+}
+
+TEST(CPUStreamsExecutorTests, pinnedTasksAreRunByTheSameStream) {
+    CPUStreamsExecutor executor{spinningExecutorConfig(2)};
+    std::vector<std::thread::id> threadIds(2);
+    for (int streamIndex = 0; streamIndex < 2; streamIndex++) {
+        std::promise<std::thread::id> promise;
+        executor.run([&] { promise.set_value(std::this_thread::get_id()); }, streamIndex);
+        threadIds[streamIndex] = promise.get_future().get();
+    }
+    ASSERT_NE(threadIds[0], threadIds[1]);
+
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        for (int streamIndex = 0; streamIndex < 2; streamIndex++) {
+            std::promise<std::thread::id> promise;
+            executor.run([&] { promise.set_value(std::this_thread::get_id()); }, streamIndex);
+            ASSERT_EQ(threadIds[streamIndex], promise.get_future().get());
+        }
+    }
+}
+
+TEST(CPUStreamsExecutorTests, executeOnStreamRunsInCurrentThreadAfterStreamTask) {
+    CPUStreamsExecutor executor{spinningExecutorConfig(1)};
+    std::promise<void> streamTaskStarted;
+    std::atomic<bool> streamTaskFinished{false};
+    executor.run([&] {
+        streamTaskStarted.set_value();
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        streamTaskFinished = true;
+    }, 0);
+    streamTaskStarted.get_future().wait();
+
+    std::thread::id threadId;
+    bool finishedBefore = false;
+    executor.Execute([&] {
+        threadId = std::this_thread::get_id();
+        finishedBefore = streamTaskFinished;
+    }, 0);
+    ASSERT_EQ(std::this_thread::get_id(), threadId);
+    ASSERT_TRUE(finishedBefore);
+}
+
+TEST(CPUStreamsExecutorTests, throwsOnWrongStreamIndex) {
+    CPUStreamsExecutor executor{spinningExecutorConfig(1)};
+    ASSERT_THROW(executor.run([] {}, 1), InferenceEngineException);
+    ASSERT_THROW(executor.Execute([] {}, -1), InferenceEngineException);
+}
+
+TEST(CPUStreamsExecutorTests, sharedTaskIsTakenByIdleStream) {
+    // the executor is destroyed first, so the blocking task doesn't outlive its promises
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    std::promise<void> blockingTaskStarted;
+    CPUStreamsExecutor executor{spinningExecutorConfig(2)};
+    executor.run([&] {
+        blockingTaskStarted.set_value();
+        unblocked.wait();
+    }, 0);
+    blockingTaskStarted.get_future().wait();
+    // let the other stream stop spinning and go to sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    // only the sleeping stream can take the task, so it has to be woken up
+    std::promise<std::thread::id> promise;
+    auto future = promise.get_future();
+    executor.run([&] { promise.set_value(std::this_thread::get_id()); });
+    const auto status = future.wait_for(std::chrono::seconds{10});
+    unblock.set_value();
+    ASSERT_EQ(std::future_status::ready, status);
+}
+
+TEST(CPUStreamsExecutorTests, tasksAreNotLostWhileStreamsSpinOrSleep) {
+    constexpr int streams = 2;
+    constexpr int iterations = 500;
+    for (auto spinWaitTime : {0, 20, 1000}) {
+        auto config = spinningExecutorConfig(streams);
+        config._spinWaitTime = spinWaitTime;
+        CPUStreamsExecutor executor{config};
+        for (int i = 0; i < iterations; i++) {
+            // shared and pinned tasks, queued with and without a pause, so the streams spin, sleep or are in between
+            std::promise<void> promise;
+            if (i % 3 == 0) {
+                executor.run([&] { promise.set_value(); });
+            } else {
+                executor.run([&] { promise.set_value(); }, i % streams);
+            }
+            ASSERT_EQ(std::future_status::ready, promise.get_future().wait_for(std::chrono::seconds{10}))
+                << "spin wait time " << spinWaitTime << ", task " << i;
+            if (i % 2 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds{20});
+            }
+        }
+    }
+}
+
+TEST(CPUStreamsExecutorTests, executeOnStreamUsesThreadsOfStream) {
+    constexpr int threadsPerStream = 2;
+    CPUStreamsExecutor executor{{"TestCPUStreamsExecutor", 1, threadsPerStream, IStreamsExecutor::ThreadBindingType::NONE}};
+    const auto callerThreads = parallel_get_max_threads();
+
+    int streamThreads = 0;
+    executor.Execute([&] { streamThreads = parallel_get_max_threads(); }, 0);
+
+#if IE_THREAD == IE_THREAD_SEQ
+    ASSERT_EQ(1, streamThreads);
+#else
+    ASSERT_EQ(threadsPerStream, streamThreads);
+#endif
+    // the calling thread gets its own number of threads back
+    ASSERT_EQ(callerThreads, parallel_get_max_threads());
+}
+
+// Microbenchmark, run with --gtest_also_run_disabled_tests. Timings are printed and recorded as test properties.
+TEST(CPUStreamsExecutorTests, DISABLED_emptyTaskRoundTripTime) {
+    constexpr int iterations = 1000;
+    // Tasks go to the shared queue when streamsNum is 1 and are pinned to streams round robin otherwise
+    auto roundTripTime = [&] (int streamsNum, int spinWaitTime) {
+        auto config = spinningExecutorConfig(streamsNum);
+        config._spinWaitTime = spinWaitTime;
+        CPUStreamsExecutor executor{config};
+        std::chrono::nanoseconds total{0};
+        for (int i = 0; i < iterations; i++) {
+            std::promise<void> promise;
+            const auto start = std::chrono::steady_clock::now();
+            if (streamsNum == 1) {
+                executor.run([&] { promise.set_value(); });
+            } else {
+                executor.run([&] { promise.set_value(); }, i % streamsNum);
+            }
+            promise.get_future().wait();
+            total += std::chrono::steady_clock::now() - start;
+            // streams go idle before the next request like in a latency bound application
+            std::this_thread::sleep_for(std::chrono::microseconds{20});
+        }
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::nanoseconds>(total).count() / iterations);
+    };
+
+    const auto sleepingTime = roundTripTime(1, 0);
+    const auto spinningTime = roundTripTime(1, 1000);
+    const auto pinnedSpinningTime = roundTripTime(2, 1000);
+    RecordProperty("sleeping_ns", sleepingTime);
+    RecordProperty("spinning_ns", spinningTime);
+    RecordProperty("pinned_spinning_ns", pinnedSpinningTime);
+    std::cout << "Empty task round trip: " << sleepingTime << " ns sleeping, " << spinningTime << " ns spinning, "
+              << pinnedSpinningTime << " ns spinning with tasks pinned to 2 streams round robin" << std::endl;
+    ASSERT_GT(sleepingTime, 0);
+    ASSERT_GT(spinningTime, 0);
+    ASSERT_GT(pinnedSpinningTime, 0);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -192,6 +350,9 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(spinningExecutorConfig(getNumberOfCPUCores()));
+    },
     [] {
         auto threads = parallel_get_max_threads();
         return std::make_shared<ImmediateExecutor>();
@@ -0,0 +1,326 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_tracer.hpp>
+#include "common_test_utils/file_utils.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+namespace {
+
+struct JsonValue {
+    enum class Type { Null, Bool, Number, String, Array, Object } type = Type::Null;
+    bool boolean = false;
+    double number = 0;
+    std::string string;
+    std::vector<std::shared_ptr<JsonValue>> array;
+    std::map<std::string, std::shared_ptr<JsonValue>> object;
+
+    const JsonValue* find(const std::string& key) const {
+        auto it = object.find(key);
+        return it == object.end() ? nullptr : it->second.get();
+    }
+};
+
+// Strict parser of the subset of JSON which may be written by the tracer, throws on malformed input
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : _text(text) {}
+
+    std::shared_ptr<JsonValue> parse() {
+        auto value = parseValue();
+        skipSpaces();
+        if (_pos != _text.size())
+            fail("trailing characters");
+        return value;
+    }
+
+private:
+    void fail(const std::string& what) const {
+        throw std::runtime_error("JSON: " + what + " at " + std::to_string(_pos));
+    }
+
+    void skipSpaces() {
+        while (_pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos])))
+            ++_pos;
+    }
+
+    char peek() {
+        skipSpaces();
+        if (_pos == _text.size())
+            fail("unexpected end");
+        return _text[_pos];
+    }
+
+    void expect(char c) {
+        if (peek() != c)
+            fail(std::string("expected '") + c + "'");
+        ++_pos;
+    }
+
+    bool consume(const std::string& literal) {
+        if (_text.compare(_pos, literal.size(), literal) != 0)
+            return false;
+        _pos += literal.size();
+        return true;
+    }
+
+    std::string parseString() {
+        expect('"');
+        std::string result;
+        while (true) {
+            if (_pos == _text.size())
+                fail("unterminated string");
+            const char c = _text[_pos++];
+            if (c == '"')
+                return result;
+            if (static_cast<unsigned char>(c) < 0x20)
+                fail("control character in string");
+            if (c == '\\') {
+                if (_pos == _text.size())
+                    fail("unterminated escape");
+                const char e = _text[_pos++];
+                if (e != '"' && e != '\\' && e != '/')
+                    fail("unsupported escape");
+                result += e;
+            } else {
+                result += c;
+            }
+        }
+    }
+
+    std::shared_ptr<JsonValue> parseValue() {
+        auto value = std::make_shared<JsonValue>();
+        const char c = peek();
+        if (c == '{') {
+            value->type = JsonValue::Type::Object;
+            ++_pos;
+            if (peek() == '}') {
+                ++_pos;
+                return value;
+            }
+            do {
+                auto key = parseString();
+                expect(':');
+                if (!value->object.emplace(key, parseValue()).second)
+                    fail("duplicate key " + key);
+            } while (peek() == ',' && ++_pos);
+            expect('}');
+        } else if (c == '[') {
+            value->type = JsonValue::Type::Array;
+            ++_pos;
+            if (peek() == ']') {
+                ++_pos;
+                return value;
+            }
+            do {
+                value->array.push_back(parseValue());
+            } while (peek() == ',' && ++_pos);
+            expect(']');
+        } else if (c == '"') {
+            value->type = JsonValue::Type::String;
+            value->string = parseString();
+        } else if (consume("true")) {
+            value->type = JsonValue::Type::Bool;
+            value->boolean = true;
+        } else if (consume("false")) {
+            value->type = JsonValue::Type::Bool;
+        } else if (consume("null")) {
+            value->type = JsonValue::Type::Null;
+        } else {
+            const char* begin = _text.c_str() + _pos;
+            char* end = nullptr;
+            value->type = JsonValue::Type::Number;
+            value->number = std::strtod(begin, &end);
+            if (end == begin)
+                fail("unexpected character");
+            _pos += end - begin;
+        }
+        return value;
+    }
+
+    const std::string _text;
+    std::size_t _pos = 0;
+};
+
+std::shared_ptr<JsonValue> readTrace(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return JsonParser(content.str()).parse();
+}
+
+// Checks fields required by Chrome trace viewer and returns the events
+const std::vector<std::shared_ptr<JsonValue>>& checkTraceEvents(const JsonValue& trace) {
+    EXPECT_EQ(JsonValue::Type::Object, trace.type);
+    auto events = trace.find("traceEvents");
+    if (events == nullptr || events->type != JsonValue::Type::Array)
+        throw std::runtime_error("traceEvents array is missing");
+
+    for (const auto& event : events->array) {
+        EXPECT_EQ(JsonValue::Type::Object, event->type);
+        for (const auto& key : {"name", "ph"}) {
+            auto field = event->find(key);
+            EXPECT_TRUE(field != nullptr && field->type == JsonValue::Type::String) << key;
+        }
+        for (const auto& key : {"pid", "tid"}) {
+            auto field = event->find(key);
+            EXPECT_TRUE(field != nullptr && field->type == JsonValue::Type::Number) << key;
+        }
+
+        const auto& phase = event->find("ph")->string;
+        if (phase == "X" || phase == "i") {
+            auto ts = event->find("ts");
+            EXPECT_TRUE(ts != nullptr && ts->type == JsonValue::Type::Number && ts->number >= 0);
+            auto cat = event->find("cat");
+            EXPECT_TRUE(cat != nullptr && cat->type == JsonValue::Type::String);
+        }
+        if (phase == "X") {
+            auto dur = event->find("dur");
+            EXPECT_TRUE(dur != nullptr && dur->type == JsonValue::Type::Number && dur->number >= 0);
+        }
+    }
+    return events->array;
+}
+
+}  // namespace
+
+class TracerTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        setTraceFile({});
+        for (const auto& path : _files)
+            CommonTestUtils::removeFile(path);
+    }
+
+    std::string traceFile(const std::string& suffix) {
+        _files.push_back("ie_tracer_test_" + suffix + ".json");
+        return _files.back();
+    }
+
+    std::vector<std::string> _files;
+};
+
+TEST_F(TracerTests, writesChromeTraceOfAllThreads) {
+    const auto path = traceFile("threads");
+    setTraceFile(path);
+    ASSERT_TRUE(isTracingEnabled());
+
+    constexpr int threadsNum = 4;
+    constexpr int eventsPerThread = 100;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; ++t) {
+        threads.emplace_back([t] {
+            setTraceThreadName("tracer \"test\" thread " + std::to_string(t));
+            for (int i = 0; i < eventsPerThread; ++i) {
+                IE_TRACE_SCOPE("tracer_test_scope", "test");
+                traceInstant("tracer_test_instant", "test");
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Disabling the tracer writes the file
+    setTraceFile({});
+    ASSERT_FALSE(isTracingEnabled());
+
+    std::shared_ptr<JsonValue> trace;
+    ASSERT_NO_THROW(trace = readTrace(path));
+    const auto& events = checkTraceEvents(*trace);
+
+    std::map<std::string, int> counts;
+    int threadNames = 0;
+    for (const auto& event : events) {
+        const auto& name = event->find("name")->string;
+        const auto& phase = event->find("ph")->string;
+        if (phase == "M") {
+            ASSERT_EQ("thread_name", name);
+            auto args = event->find("args");
+            ASSERT_NE(nullptr, args);
+            if (args->find("name")->string.find("tracer \"test\" thread") == 0)
+                ++threadNames;
+            continue;
+        }
+        counts[name + ":" + phase]++;
+    }
+
+    EXPECT_EQ(threadsNum, threadNames);
+    EXPECT_EQ(threadsNum * eventsPerThread, counts["tracer_test_scope:X"]);
+    EXPECT_EQ(threadsNum * eventsPerThread, counts["tracer_test_instant:i"]);
+}
+
+TEST_F(TracerTests, dumpIsConsistentWhileThreadsRecord) {
+    // Each event lasts exactly 1 us, a torn event would have other name or duration
+    constexpr std::uint64_t duration = 1000;
+    std::atomic<bool> stop {false};
+    std::vector<std::thread> threads;
+    setTraceFile(traceFile("race_0"));
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([&] {
+            while (!stop.load()) {
+                const auto begin = traceTimestamp();
+                traceEvent("tracer_test_writer", "test", begin, begin + duration);
+            }
+        });
+    }
+
+    constexpr int dumpsNum = 5;
+    for (int d = 1; d <= dumpsNum; ++d) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Switching the file writes the previous one while the writers keep recording
+        setTraceFile(traceFile("race_" + std::to_string(d)));
+    }
+    stop = true;
+    for (auto& thread : threads)
+        thread.join();
+    setTraceFile({});
+
+    for (const auto& path : _files) {
+        std::shared_ptr<JsonValue> trace;
+        ASSERT_NO_THROW(trace = readTrace(path)) << path;
+        for (const auto& event : checkTraceEvents(*trace)) {
+            if (event->find("ph")->string == "M")
+                continue;
+            ASSERT_EQ("tracer_test_writer", event->find("name")->string) << path;
+            ASSERT_EQ("X", event->find("ph")->string) << path;
+            ASSERT_DOUBLE_EQ(duration / 1000.0, event->find("dur")->number) << path;
+        }
+    }
+}
+
+TEST_F(TracerTests, internedNamesAreReusedAndLimited) {
+    const auto name = internTraceName("tracer_test_interned");
+    ASSERT_STREQ("tracer_test_interned", name);
+    ASSERT_EQ(name, internTraceName(std::string("tracer_test_interned")));
+
+    // Names generated per object must not grow the table without bound
+    const char* last = nullptr;
+    const char* beforeLast = nullptr;
+    for (int i = 0; i < 10000; ++i) {
+        beforeLast = last;
+        last = internTraceName("tracer_test_generated_" + std::to_string(i));
+    }
+    ASSERT_EQ(beforeLast, last);
+    ASSERT_STRNE("tracer_test_generated_9999", last);
+
+    // Names interned before the limit was reached stay valid
+    ASSERT_EQ(name, internTraceName("tracer_test_interned"));
+}
@@ -0,0 +1,168 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_ops/scaled_dot_product_attention_ie.hpp>
+#include <transformations/scaled_dot_product_attention_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+// Keeps the original subgraph, like plugins do for unsupported cases
+bool skip_attention_callback(const std::shared_ptr<const ngraph::Node> & node) {
+    return std::dynamic_pointer_cast<const ngraph::op::ScaledDotProductAttentionIE>(node) != nullptr;
+}
+
+}  // namespace
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 12, 128, 64});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 12, 128, 64});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 12, 128, 64});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 1, 1, 128});
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {8});
+        auto scaled = std::make_shared<ngraph::opset1::Divide>(qk, scale);
+        auto masked = std::make_shared<ngraph::opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(masked, 3);
+        auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{query, key, value, mask});
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+
+        auto fusion = ngraph::pass::ScaledDotProductAttentionFusion();
+        fusion.run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 12, 128, 64});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 12, 128, 64});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 12, 128, 64});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 1, 1, 128});
+        auto attention = std::make_shared<ngraph::op::ScaledDotProductAttentionIE>(query, key, value, mask, 0.125f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value, mask});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto attention = std::dynamic_pointer_cast<ngraph::op::ScaledDotProductAttentionIE>(
+            f->get_results()[0]->input_value(0).get_node_shared_ptr());
+    ASSERT_NE(attention, nullptr);
+    ASSERT_FLOAT_EQ(attention->get_scale(), 0.125f);
+    ASSERT_TRUE(attention->get_transpose_key());
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionNoMaskKeyNotTransposed) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 32, 24});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 24, 40});
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {0.5});
+        auto scaled = std::make_shared<ngraph::opset1::Multiply>(scale, qk);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scaled, 2);
+        auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{query, key, value});
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+
+        auto fusion = ngraph::pass::ScaledDotProductAttentionFusion();
+        fusion.run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 32, 24});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 24, 40});
+        auto attention = std::make_shared<ngraph::op::ScaledDotProductAttentionIE>(query, key, value, 0.5f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionSoftmaxNotOnLastAxis) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 40});
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 1);
+        auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{query, key, value});
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+
+        auto fusion = ngraph::pass::ScaledDotProductAttentionFusion();
+        fusion.run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 40});
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 1);
+        auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{query, key, value});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionSkippedByCallback) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 32});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16, 40});
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 2);
+        auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{query, key, value});
+    };
+
+    f = create_function();
+    ngraph::pass::InitNodeInfo().run_on_function(f);
+
+    auto fusion = ngraph::pass::ScaledDotProductAttentionFusion();
+    fusion.setCallback(skip_attention_callback);
+    fusion.run_on_function(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
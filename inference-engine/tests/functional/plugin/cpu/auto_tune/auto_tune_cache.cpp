@@ -0,0 +1,132 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <threading/ie_executor_manager.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+InferenceEngine::CNNNetwork makeConvNetwork() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8, 16, 16});
+    std::vector<float> weightsData(8 * 8 * 3 * 3, 0.01f);
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8, 8, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+            ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+    return InferenceEngine::CNNNetwork(function);
+}
+
+struct CacheEntry {
+    std::string key;
+    int streams = 0;
+    int threads = 0;
+};
+
+std::vector<CacheEntry> readCache(const std::string& path) {
+    std::vector<CacheEntry> entries;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        CacheEntry entry;
+        if (stream >> entry.key >> entry.streams >> entry.threads)
+            entries.push_back(entry);
+    }
+    return entries;
+}
+
+int getStreams(const ExecutableNetwork& execNetwork) {
+    return std::stoi(execNetwork.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>());
+}
+
+class CPUAutoTuneTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cachePath = "cpu_auto_tune_cache_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name())
+                    + ".txt";
+        std::remove(cachePath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(cachePath.c_str());
+    }
+
+    std::map<std::string, std::string> tuneConfig() const {
+        return {{CPUConfigParams::KEY_CPU_AUTO_TUNE, CPUConfigParams::CPU_TUNE_THROUGHPUT},
+                {CPUConfigParams::KEY_CPU_AUTO_TUNE_TIME, "20"},
+                {CPUConfigParams::KEY_CPU_AUTO_TUNE_CACHE, cachePath}};
+    }
+
+    std::string cachePath;
+};
+
+}  // namespace
+
+TEST_F(CPUAutoTuneTests, TunedConfigIsStoredInCache) {
+    auto network = makeConvNetwork();
+    Core ie;
+
+    auto execNetwork = ie.LoadNetwork(network, "CPU", tuneConfig());
+
+    auto entries = readCache(cachePath);
+    ASSERT_EQ(1, entries.size());
+    ASSERT_GT(entries[0].streams, 0);
+    ASSERT_EQ(entries[0].streams, getStreams(execNetwork));
+
+    // Same model is tuned once
+    ie.LoadNetwork(network, "CPU", tuneConfig());
+    ASSERT_EQ(1, readCache(cachePath).size());
+}
+
+TEST_F(CPUAutoTuneTests, CachedConfigIsAppliedWithoutTuning) {
+    auto network = makeConvNetwork();
+    Core ie;
+    ie.LoadNetwork(network, "CPU", tuneConfig());
+    auto entries = readCache(cachePath);
+    ASSERT_EQ(1, entries.size());
+
+    // A value other than the tuned one proves the network takes it from the file
+    const int cachedStreams = entries[0].streams == 1 ? 2 : 1;
+    {
+        std::ofstream file(cachePath);
+        file << entries[0].key << " " << cachedStreams << " " << entries[0].threads << "\n";
+    }
+
+    auto execNetwork = ie.LoadNetwork(network, "CPU", tuneConfig());
+    ASSERT_EQ(cachedStreams, getStreams(execNetwork));
+}
+
+TEST_F(CPUAutoTuneTests, CandidateExecutorsAreReleased) {
+    auto network = makeConvNetwork();
+    Core ie;
+
+    ExecutorManager::getInstance()->clear();
+    auto tunedNetwork = ie.LoadNetwork(network, "CPU", tuneConfig());
+    const auto tunedExecutorsNumber = ExecutorManager::getInstance()->getIdleCPUStreamsExecutorsNumber();
+    const auto streams = std::to_string(getStreams(tunedNetwork));
+    tunedNetwork = {};
+
+    // Tuned network holds the same executors as the network loaded with the selected config directly
+    ExecutorManager::getInstance()->clear();
+    auto execNetwork = ie.LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams}});
+    ASSERT_EQ(ExecutorManager::getInstance()->getIdleCPUStreamsExecutorsNumber(), tunedExecutorsNumber);
+}
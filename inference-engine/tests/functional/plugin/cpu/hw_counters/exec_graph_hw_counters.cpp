@@ -0,0 +1,134 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+
+#include <ngraph/variant.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace {
+
+// 1x16x8x8 input, 32 output channels, 3x3 kernel with same padding
+constexpr uint64_t convFlops = 2 * (32 * 8 * 8) * (16 * 3 * 3);
+
+CNNNetwork makeConvNetwork() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 8, 8});
+    std::vector<float> weightsData(32 * 16 * 3 * 3);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = static_cast<float>(i % 7) * 0.01f - 0.03f;
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{32, 16, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+            ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+    return CNNNetwork(function);
+}
+
+// Checks whether the kernel allows the process to count cycles of its threads
+bool canOpenHwCounters() {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const auto fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0)
+        return false;
+    close(fd);
+    return true;
+#else
+    return false;
+#endif
+}
+
+using Attributes = std::map<std::string, std::string>;
+
+// Runtime attributes of every executable graph node by its layer type
+std::multimap<std::string, Attributes> inferAndGetExecGraph(const std::string& hwCounters) {
+    Core ie;
+    auto network = makeConvNetwork();
+    auto execNetwork = ie.LoadNetwork(network, "CPU", {{CPUConfigParams::KEY_CPU_HW_COUNTERS, hwCounters}});
+    auto request = execNetwork.CreateInferRequest();
+    FuncTestUtils::fillInputsBySinValues(request.GetBlob(network.getInputsInfo().begin()->first));
+    for (int i = 0; i < 10; i++)
+        request.Infer();
+
+    auto function = execNetwork.GetExecGraphInfo().getFunction();
+    IE_ASSERT(nullptr != function);
+
+    std::multimap<std::string, Attributes> nodes;
+    for (const auto& op : function->get_ops()) {
+        Attributes attributes;
+        for (const auto& rtInfo : op->get_rt_info()) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(rtInfo.second))
+                attributes[rtInfo.first] = value->get();
+        }
+        const auto layerType = attributes[ExecGraphInfoSerialization::LAYER_TYPE];
+        nodes.emplace(layerType, attributes);
+    }
+    return nodes;
+}
+
+}  // namespace
+
+TEST(CPUExecGraphHwCountersTests, EstimatedGFlopsMatchExecTime) {
+    const auto nodes = inferAndGetExecGraph(PluginConfigParams::NO);
+    ASSERT_EQ(1u, nodes.count("Convolution"));
+    const auto& conv = nodes.find("Convolution")->second;
+
+    ASSERT_EQ(1u, conv.count(ExecGraphInfoSerialization::ESTIMATED_GFLOPS));
+    ASSERT_EQ(1u, conv.count(ExecGraphInfoSerialization::ESTIMATED_GBPS));
+    const auto gflops = std::strtod(conv.at(ExecGraphInfoSerialization::ESTIMATED_GFLOPS).c_str(), nullptr);
+    ASSERT_GT(gflops, 0.0);
+
+    // GFLOPS are computed from the average time in nanoseconds, execTimeMcs is the same time truncated to microseconds
+    const auto execTimeMcs = std::strtod(conv.at(ExecGraphInfoSerialization::PERF_COUNTER).c_str(), nullptr);
+    const auto avgNs = convFlops / gflops;
+    ASSERT_GE(avgNs, execTimeMcs * 1000.0 * 0.99);
+    ASSERT_LT(avgNs, (execTimeMcs + 1) * 1000.0 * 1.01);
+}
+
+TEST(CPUExecGraphHwCountersTests, HwCountersAreReportedOnlyWhenEnabled) {
+    for (const auto& node : inferAndGetExecGraph(PluginConfigParams::NO)) {
+        ASSERT_EQ(0u, node.second.count(ExecGraphInfoSerialization::HW_CYCLES)) << node.first;
+        ASSERT_EQ(0u, node.second.count(ExecGraphInfoSerialization::HW_INSTRUCTIONS)) << node.first;
+    }
+
+    if (!canOpenHwCounters())
+        GTEST_SKIP() << "perf_event_open is not permitted";
+
+    const auto nodes = inferAndGetExecGraph(PluginConfigParams::YES);
+    ASSERT_EQ(1u, nodes.count("Convolution"));
+    const auto& conv = nodes.find("Convolution")->second;
+    ASSERT_EQ(1u, conv.count(ExecGraphInfoSerialization::HW_CYCLES));
+    ASSERT_EQ(1u, conv.count(ExecGraphInfoSerialization::HW_INSTRUCTIONS));
+    ASSERT_EQ(1u, conv.count(ExecGraphInfoSerialization::HW_LLC_MISSES));
+    ASSERT_GT(std::stoull(conv.at(ExecGraphInfoSerialization::HW_CYCLES)), 0u);
+    // the convolution can't be computed with fewer instructions than its output elements
+    ASSERT_GT(std::stoull(conv.at(ExecGraphInfoSerialization::HW_INSTRUCTIONS)), 32u * 8 * 8);
+}
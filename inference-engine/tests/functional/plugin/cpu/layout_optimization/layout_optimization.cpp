@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+
+#include <ngraph/variant.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+size_t countReorders(ExecutableNetwork& execNetwork) {
+    auto execGraphInfo = execNetwork.GetExecGraphInfo();
+    auto function = execGraphInfo.getFunction();
+    IE_ASSERT(nullptr != function);
+
+    size_t reorders = 0;
+    for (const auto& op : function->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        auto it = rtInfo.find("layerType");
+        IE_ASSERT(rtInfo.end() != it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != value);
+        if (value->get() == "Reorder")
+            reorders++;
+    }
+    return reorders;
+}
+
+std::vector<float> inferSinValues(ExecutableNetwork& execNetwork) {
+    auto request = execNetwork.CreateInferRequest();
+    for (auto&& input : execNetwork.GetInputsInfo()) {
+        FuncTestUtils::fillInputsBySinValues(request.GetBlob(input.first));
+    }
+    request.Infer();
+
+    auto output = as<MemoryBlob>(request.GetBlob(execNetwork.GetOutputsInfo().begin()->first));
+    IE_ASSERT(nullptr != output);
+    auto outputMemory = output->rmap();
+    auto data = outputMemory.as<const float*>();
+    return {data, data + output->size()};
+}
+
+}  // namespace
+
+TEST(CPULayoutOptimizationTests, DoesNotIncreaseReordersAndKeepsResults) {
+    CNNNetwork network(ngraph::builder::subgraph::makeSplitMultiConvConcat());
+    Core ie;
+
+    std::map<std::string, size_t> reorders;
+    std::map<std::string, std::vector<float>> outputs;
+    for (auto&& optimizeLayouts : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+        auto execNetwork = ie.LoadNetwork(network, "CPU", {{CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, optimizeLayouts}});
+        reorders[optimizeLayouts] = countReorders(execNetwork);
+        outputs[optimizeLayouts] = inferSinValues(execNetwork);
+    }
+
+    ASSERT_LE(reorders[PluginConfigParams::YES], reorders[PluginConfigParams::NO]);
+
+    const auto& expected = outputs[PluginConfigParams::NO];
+    const auto& actual = outputs[PluginConfigParams::YES];
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], 1e-4f * std::max(1.f, std::fabs(expected[i]))) << "at index " << i;
+    }
+}
+
+TEST(CPULayoutOptimizationTests, ReordersReportListsEveryReorder) {
+    CNNNetwork network(ngraph::builder::subgraph::makeSplitMultiConvConcat());
+    const std::string dumpName = "CPULayoutOptimizationTests_report";
+    const std::string reportName = dumpName + "_reorders.csv";
+    Core ie;
+
+    auto execNetwork = ie.LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES},
+                                                       {PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpName}});
+    const auto expectedReorders = countReorders(execNetwork);
+    auto request = execNetwork.CreateInferRequest();
+    request.Infer();
+    request.GetPerformanceCounts();
+
+    std::ifstream report(reportName);
+    ASSERT_TRUE(report.is_open());
+    std::string line;
+    ASSERT_TRUE(static_cast<bool>(std::getline(report, line)));
+    ASSERT_EQ("name;parent;child;src;dst;elements;avg_uSec", line);
+
+    size_t reorderLines = 0;
+    std::string total;
+    while (std::getline(report, line)) {
+        ASSERT_EQ(6, std::count(line.begin(), line.end(), ';')) << line;
+        if (line.find("total;") == 0) {
+            total = line;
+            break;
+        }
+        reorderLines++;
+    }
+    ASSERT_EQ(expectedReorders, reorderLines);
+    ASSERT_EQ(0, total.find("total;" + std::to_string(expectedReorders) + ";")) << total;
+
+    report.close();
+    std::remove(reportName.c_str());
+    std::remove((dumpName + "_init.dot").c_str());
+    std::remove((dumpName + "_perf.dot").c_str());
+}
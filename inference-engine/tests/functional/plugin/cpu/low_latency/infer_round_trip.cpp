@@ -0,0 +1,146 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// The smallest network which still goes through the whole inference pipeline
+InferenceEngine::CNNNetwork makeEmptyNetwork() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+    return InferenceEngine::CNNNetwork(function);
+}
+
+// Counts tasks which were executed by threads of the CPU plugin streams executor
+size_t countStreamTasks(const std::string& traceFile) {
+    std::ifstream file(traceFile);
+    std::stringstream content;
+    content << file.rdbuf();
+    const auto text = content.str();
+    const std::string taskEvent = "{\"name\":\"CPUStreamsExecutor\",\"cat\":\"executor\"";
+
+    size_t tasks = 0;
+    for (auto pos = text.find(taskEvent); pos != std::string::npos; pos = text.find(taskEvent, pos + 1)) {
+        tasks++;
+    }
+    return tasks;
+}
+
+std::map<std::string, std::string> lowLatencyConfig(const std::string& lowLatency, const std::string& streams) {
+    return {{CPUConfigParams::KEY_CPU_LOW_LATENCY, lowLatency},
+            {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams}};
+}
+
+}  // namespace
+
+TEST(CPULowLatencyTests, SyncInferDoesNotWakeUpStreamThreads) {
+    auto network = makeEmptyNetwork();
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const std::string traceFile = "CPULowLatencyTests_trace.json";
+    Core ie;
+
+    constexpr int iterations = 100;
+    std::map<std::string, size_t> streamTasks;
+    std::map<std::string, std::vector<float>> outputs;
+    for (auto&& lowLatency : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+        auto execNetwork = ie.LoadNetwork(network, "CPU", lowLatencyConfig(lowLatency, "1"));
+        auto request = execNetwork.CreateInferRequest();
+        FuncTestUtils::fillInputsBySinValues(request.GetBlob(inputName));
+
+        // Tasks taken by stream threads are recorded by the tracer, so only the inferences are traced
+        ie.SetConfig({{CONFIG_KEY(PERF_TRACE_FILE), traceFile}});
+        for (int i = 0; i < iterations; i++) {
+            request.Infer();
+        }
+        ie.SetConfig({{CONFIG_KEY(PERF_TRACE_FILE), ""}});
+        streamTasks[lowLatency] = countStreamTasks(traceFile);
+        std::remove(traceFile.c_str());
+
+        auto output = as<MemoryBlob>(request.GetBlob(outputName));
+        ASSERT_NE(nullptr, output);
+        auto outputMemory = output->rmap();
+        auto data = outputMemory.as<const float*>();
+        outputs[lowLatency].assign(data, data + output->size());
+    }
+
+    // Every request is a task for a stream thread, unless it is inferred on the calling thread
+    ASSERT_GE(streamTasks[PluginConfigParams::NO], static_cast<size_t>(iterations));
+    ASSERT_EQ(0u, streamTasks[PluginConfigParams::YES]);
+    ASSERT_EQ(outputs[PluginConfigParams::NO], outputs[PluginConfigParams::YES]);
+}
+
+// Microbenchmark, run with --gtest_also_run_disabled_tests. Timings are printed and recorded as test properties.
+TEST(CPULowLatencyTests, DISABLED_InferRoundTripTime) {
+    auto network = makeEmptyNetwork();
+    const auto inputName = network.getInputsInfo().begin()->first;
+    Core ie;
+
+    constexpr int iterations = 1000;
+    for (auto&& lowLatency : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+        auto execNetwork = ie.LoadNetwork(network, "CPU", lowLatencyConfig(lowLatency, "1"));
+        auto request = execNetwork.CreateInferRequest();
+        FuncTestUtils::fillInputsBySinValues(request.GetBlob(inputName));
+
+        // warm up
+        request.Infer();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            request.Infer();
+        }
+        const auto duration = std::chrono::steady_clock::now() - start;
+        const auto roundTripTime = std::chrono::duration<double, std::micro>(duration).count() / iterations;
+
+        RecordProperty(lowLatency == PluginConfigParams::YES ? "low_latency_us" : "default_us", std::to_string(roundTripTime));
+        std::cout << "Empty network Infer() round trip: " << roundTripTime << " us"
+                  << (lowLatency == PluginConfigParams::YES ? " in low latency mode" : "") << std::endl;
+        ASSERT_GT(roundTripTime, 0.0);
+    }
+}
+
+TEST(CPULowLatencyTests, RequestsPinnedToStreamsCanRunAsync) {
+    auto network = makeEmptyNetwork();
+    const auto inputName = network.getInputsInfo().begin()->first;
+    Core ie;
+
+    auto execNetwork = ie.LoadNetwork(network, "CPU", lowLatencyConfig(PluginConfigParams::YES, "2"));
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 4; i++) {
+        requests.push_back(execNetwork.CreateInferRequest());
+        FuncTestUtils::fillInputsBySinValues(requests.back().GetBlob(inputName));
+    }
+
+    for (int iteration = 0; iteration < 10; iteration++) {
+        for (auto&& request : requests) {
+            ASSERT_NO_THROW(request.StartAsync());
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+        }
+        for (auto&& request : requests) {
+            ASSERT_NO_THROW(request.Infer());
+        }
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "ngraph/opsets/opset3.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t stateSize = 8;
+
+// out = 2 * state', where state' = relu(state) + in is stored back into the state.
+// The state is consumed before its new value is produced, so the CPU plugin keeps it in place.
+CNNNetwork makeAccumulatorNetwork() {
+    auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1, stateSize});
+    auto init = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1, stateSize},
+                                                 std::vector<float>(stateSize, 0.f));
+    auto readValue = std::make_shared<ngraph::opset3::ReadValue>(init, "accumulator");
+    auto relu = std::make_shared<ngraph::opset3::Relu>(readValue);
+    auto add = std::make_shared<ngraph::opset3::Add>(relu, input);
+    auto assign = std::make_shared<ngraph::opset3::Assign>(add, "accumulator");
+    auto scale = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1}, {2.f});
+    auto multiply = std::make_shared<ngraph::opset3::Multiply>(add, scale);
+    auto result = std::make_shared<ngraph::opset3::Result>(multiply);
+
+    assign->add_control_dependency(readValue);
+    result->add_control_dependency(assign);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                       ngraph::ParameterVector{input}, "Accumulator");
+    return CNNNetwork(function);
+}
+
+class CPUMemoryStateTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto network = makeAccumulatorNetwork();
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        execNetwork = ie.LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+        request = execNetwork.CreateInferRequest();
+
+        auto input = as<MemoryBlob>(request.GetBlob(inputName));
+        ASSERT_NE(nullptr, input);
+        auto inputMemory = input->wmap();
+        auto data = inputMemory.as<float*>();
+        for (size_t i = 0; i < stateSize; i++) {
+            data[i] = static_cast<float>(i + 1);
+        }
+    }
+
+    // Runs inference and checks that the output is 2 * (state + in), where in[i] = i + 1
+    void inferAndCheck(const std::vector<float>& state) {
+        request.Infer();
+        auto output = as<MemoryBlob>(request.GetBlob(outputName));
+        ASSERT_NE(nullptr, output);
+        ASSERT_EQ(stateSize, output->size());
+        auto outputMemory = output->rmap();
+        auto data = outputMemory.as<const float*>();
+        for (size_t i = 0; i < stateSize; i++) {
+            ASSERT_FLOAT_EQ(2.f * (state[i] + static_cast<float>(i + 1)), data[i]) << "at index " << i;
+        }
+    }
+
+    // The state after n inferences from the initial one
+    static std::vector<float> accumulated(int n) {
+        std::vector<float> state(stateSize);
+        for (size_t i = 0; i < stateSize; i++) {
+            state[i] = static_cast<float>(n * (i + 1));
+        }
+        return state;
+    }
+
+    Core ie;
+    ExecutableNetwork execNetwork;
+    InferRequest request;
+    std::string inputName;
+    std::string outputName;
+};
+
+}  // namespace
+
+TEST_F(CPUMemoryStateTests, StateIsKeptBetweenInferCalls) {
+    for (int i = 0; i < 4; i++) {
+        SCOPED_TRACE("iteration " + std::to_string(i));
+        ASSERT_NO_FATAL_FAILURE(inferAndCheck(accumulated(i)));
+    }
+}
+
+TEST_F(CPUMemoryStateTests, ResetAndSetStateAreApplied) {
+    auto states = execNetwork.QueryState();
+    ASSERT_EQ(1, states.size());
+    ASSERT_EQ("accumulator", states.front().GetName());
+
+    ASSERT_NO_FATAL_FAILURE(inferAndCheck(accumulated(0)));
+    ASSERT_NO_FATAL_FAILURE(inferAndCheck(accumulated(1)));
+
+    states.front().Reset();
+    ASSERT_NO_FATAL_FAILURE(inferAndCheck(accumulated(0)));
+    ASSERT_NO_FATAL_FAILURE(inferAndCheck(accumulated(1)));
+
+    std::vector<float> newState(stateSize, 10.f);
+    auto stateBlob = make_shared_blob<float>({Precision::FP32, {1, stateSize}, Layout::NC}, newState.data());
+    states.front().SetState(stateBlob);
+    ASSERT_NO_FATAL_FAILURE(inferAndCheck(newState));
+
+    for (size_t i = 0; i < stateSize; i++) {
+        newState[i] += static_cast<float>(i + 1);
+    }
+    ASSERT_NO_FATAL_FAILURE(inferAndCheck(newState));
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t convWeightsSize = 32 * 16 * 3 * 3;
+
+CNNNetwork makeConvNetwork() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 8, 8});
+    std::vector<float> weightsData(convWeightsSize);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = static_cast<float>(i % 7) * 0.01f - 0.03f;
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{32, 16, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+            ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+    return CNNNetwork(function);
+}
+
+}  // namespace
+
+TEST(CPUMemoryUsageTests, NetworkWeightsAreCountedInTotal) {
+    Core ie;
+    auto execNetwork = ie.LoadNetwork(makeConvNetwork(), "CPU");
+    std::map<std::string, uint64_t> usage = execNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(MEMORY_USAGE));
+
+    ASSERT_EQ(1u, usage.count("network_weights"));
+    // the cloned network keeps the original FP32 weights of the convolution
+    ASSERT_GE(usage["network_weights"], convWeightsSize * sizeof(float));
+    ASSERT_GE(usage["total"], usage["network_weights"] + usage["weights"]);
+
+    std::map<std::string, uint64_t> deviceUsage = ie.GetMetric("CPU", METRIC_KEY(MEMORY_USAGE));
+    ASSERT_GE(deviceUsage["network_weights"], usage["network_weights"]);
+    ASSERT_GE(deviceUsage["total"], usage["total"]);
+}
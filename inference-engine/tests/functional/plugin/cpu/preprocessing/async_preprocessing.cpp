@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+InferenceEngine::CNNNetwork makeReluNetwork() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 8, 8});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+    return InferenceEngine::CNNNetwork(function);
+}
+
+// Number of streams, a single stream has a separate pre-processing stage
+class CPUAsyncPreprocessingTests : public ::testing::TestWithParam<std::string> {
+protected:
+    static constexpr int requestsNumber = 6;
+    static constexpr int iterations = 20;
+
+    // Every request gets its own value on every iteration, so inputs mixed up between requests are visible
+    static float valueOf(int request, int iteration) {
+        return static_cast<float>(1 + request + requestsNumber * iteration);
+    }
+
+    template <typename SetInput>
+    void run(CNNNetwork network, SetInput setInput) {
+        Core ie;
+        auto execNetwork = ie.LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, GetParam()}});
+        const auto inputName = network.getInputsInfo().begin()->first;
+        const auto outputName = network.getOutputsInfo().begin()->first;
+
+        std::vector<InferRequest> requests;
+        for (int r = 0; r < requestsNumber; r++)
+            requests.push_back(execNetwork.CreateInferRequest());
+
+        for (int i = 0; i < iterations; i++) {
+            for (int r = 0; r < requestsNumber; r++) {
+                setInput(requests[r], inputName, valueOf(r, i));
+                requests[r].StartAsync();
+            }
+            for (int r = 0; r < requestsNumber; r++) {
+                ASSERT_EQ(StatusCode::OK, requests[r].Wait(IInferRequest::WaitMode::RESULT_READY));
+                auto output = as<MemoryBlob>(requests[r].GetBlob(outputName));
+                auto outputMemory = output->rmap();
+                const float* data = outputMemory.as<const float*>();
+                for (size_t e = 0; e < output->size(); e++)
+                    ASSERT_EQ(valueOf(r, i), data[e]) << "request " << r << ", iteration " << i << ", element " << e;
+            }
+        }
+    }
+};
+
+}  // namespace
+
+// U16 inputs are converted to FP32 by the pre-processing
+TEST_P(CPUAsyncPreprocessingTests, PrecisionConversionOfConcurrentRequests) {
+    auto network = makeReluNetwork();
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U16);
+
+    run(network, [](InferRequest& request, const std::string& inputName, float value) {
+        auto input = as<MemoryBlob>(request.GetBlob(inputName));
+        auto inputMemory = input->wmap();
+        uint16_t* data = inputMemory.as<uint16_t*>();
+        std::fill(data, data + input->size(), static_cast<uint16_t>(value));
+    });
+}
+
+// Resize of a uniform image keeps its value, so the result of every request is known
+TEST_P(CPUAsyncPreprocessingTests, ResizeOfConcurrentRequests) {
+    auto network = makeReluNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->getPreProcess().setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+
+    run(network, [](InferRequest& request, const std::string& inputName, float value) {
+        auto input = make_shared_blob<uint8_t>({Precision::U8, {1, 3, 16, 16}, Layout::NCHW});
+        input->allocate();
+        uint8_t* data = input->buffer().as<uint8_t*>();
+        std::fill(data, data + input->size(), static_cast<uint8_t>(value));
+        request.SetBlob(inputName, input);
+    });
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUAsyncPreprocessing, CPUAsyncPreprocessingTests, ::testing::Values("1", "2", "4"));
@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "cpu/cpu_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -24,7 +25,11 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_COUNTERS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LOW_LATENCY, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +64,12 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_AUTO_TUNE, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_AUTO_TUNE_TIME, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_COUNTERS, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LOW_LATENCY, "OFF"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -46,4 +46,50 @@ INSTANTIATE_TEST_CASE_P(
         GatherLayerTest::getTestCaseName
 );
 
+// Rows of one element are gathered by the element kernel, longer rows by the row kernel
+
+const std::vector<std::vector<size_t>> elementsInputShapes = {
+        std::vector<size_t>{1000},
+        std::vector<size_t>{4, 1000},
+        std::vector<size_t>{3, 5, 1000},
+};
+
+const auto elementsParams = testing::Combine(
+        testing::Values(std::vector<int>{999, 0, 500, 1}),
+        testing::ValuesIn(indicesShapes),
+        testing::Values(-1),
+        testing::ValuesIn(elementsInputShapes),
+        testing::ValuesIn(netPrecisions),
+        testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(
+        GatherElements,
+        GatherLayerTest,
+        elementsParams,
+        GatherLayerTest::getTestCaseName
+);
+
+const std::vector<std::vector<size_t>> rowsInputShapes = {
+        std::vector<size_t>{1, 200, 3},
+        std::vector<size_t>{3, 200, 16},
+        std::vector<size_t>{2, 200, 2, 2},
+};
+
+const auto rowsParams = testing::Combine(
+        testing::Values(std::vector<int>{199, 0, 57, 100}),
+        testing::ValuesIn(indicesShapes),
+        testing::Values(1),
+        testing::ValuesIn(rowsInputShapes),
+        testing::ValuesIn(netPrecisions),
+        testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(
+        GatherRows,
+        GatherLayerTest,
+        rowsParams,
+        GatherLayerTest::getTestCaseName
+);
+
 }  // namespace
@@ -50,4 +50,36 @@ INSTANTIATE_TEST_CASE_P(
         params,
         ReduceOpsLayerTest::getTestCaseName
 );
+
+// Reductions over one group of adjacent axes (size 1 axes are skipped) use the unit stride kernels:
+// inner size 1, inner size of several blocks with a tail, and reduced axes separated by size 1 axes
+const std::vector<std::vector<size_t>> contiguousInputShapes = {
+        std::vector<size_t>{64, 1, 300},
+        std::vector<size_t>{8, 3, 1, 700},
+};
+
+const std::vector<std::vector<int>> contiguousAxes = {
+        {-1},
+        {1},
+        {1, 2},
+        {0, 1},
+};
+
+const auto contiguousParams = testing::Combine(
+        testing::ValuesIn(contiguousAxes),
+        testing::Values(true, false),
+        testing::Values(ngraph::helpers::ReductionType::Mean,
+                        ngraph::helpers::ReductionType::Max,
+                        ngraph::helpers::ReductionType::Sum),
+        testing::ValuesIn(netPrecisions),
+        testing::ValuesIn(contiguousInputShapes),
+        testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(
+        ReduceContiguous,
+        ReduceOpsLayerTest,
+        contiguousParams,
+        ReduceOpsLayerTest::getTestCaseName
+);
 }  // namespace
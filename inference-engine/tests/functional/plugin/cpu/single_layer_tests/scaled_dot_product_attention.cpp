@@ -0,0 +1,164 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <exec_graph_info.hpp>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,  // Query shape: batch dims, query length, head size
+        size_t,               // Key and value length
+        bool,                 // Key is transposed
+        std::vector<size_t>   // Mask shape, empty if there is no mask
+> scaledDotProductAttentionParams;
+
+// The network is MatMul(Q, K) -> Multiply -> [Add(mask)] -> Softmax -> MatMul(V), which the CPU plugin
+// fuses into ScaledDotProductAttention node, the reference is computed for the original unfused network
+class ScaledDotProductAttentionLayerCPUTest : public testing::WithParamInterface<scaledDotProductAttentionParams>,
+                                              public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<scaledDotProductAttentionParams> obj) {
+        std::vector<size_t> queryShape, maskShape;
+        size_t keyLength;
+        bool transposeKey;
+        std::tie(queryShape, keyLength, transposeKey, maskShape) = obj.param;
+
+        std::ostringstream result;
+        result << "Q=" << CommonTestUtils::vec2str(queryShape) << "_";
+        result << "KVLen=" << keyLength << "_";
+        result << "transposeKey=" << transposeKey << "_";
+        result << "mask=" << (maskShape.empty() ? "none" : CommonTestUtils::vec2str(maskShape));
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> queryShape, maskShape;
+        size_t keyLength;
+        bool transposeKey;
+        std::tie(queryShape, keyLength, transposeKey, maskShape) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t rank = queryShape.size();
+        const size_t headSize = queryShape[rank - 1];
+        auto keyShape = queryShape;
+        auto valueShape = queryShape;
+        if (transposeKey) {
+            keyShape[rank - 2] = keyLength;
+        } else {
+            keyShape[rank - 2] = headSize;
+            keyShape[rank - 1] = keyLength;
+        }
+        valueShape[rank - 2] = keyLength;
+        valueShape[rank - 1] = headSize + 8;
+
+        std::vector<std::vector<size_t>> inputShapes{queryShape, keyShape, valueShape};
+        if (!maskShape.empty())
+            inputShapes.push_back(maskShape);
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(params[0], params[1], false, transposeKey);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.125f});
+        std::shared_ptr<ngraph::Node> scores = std::make_shared<ngraph::opset1::Multiply>(qk, scale);
+        if (!maskShape.empty())
+            scores = std::make_shared<ngraph::opset1::Add>(scores, params[3]);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, rank - 1);
+        auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, params[2]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, params, "ScaledDotProductAttention");
+    }
+
+    void CheckAttentionIsFused() {
+        auto execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+
+        size_t fusedNodes = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto layerType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second)->get();
+            ASSERT_NE("SoftMax", layerType);
+            if (layerType == "ScaledDotProductAttention")
+                fusedNodes++;
+        }
+        ASSERT_EQ(1, fusedNodes);
+    }
+};
+
+TEST_P(ScaledDotProductAttentionLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckAttentionIsFused();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> queryShapes = {
+        {2, 4, 16, 32},
+        {3, 7, 24},
+};
+
+const std::vector<size_t> keyLengths = {16, 37};
+
+// Masks of the same rank and of a lower rank, broadcasted over batch, heads and query positions
+const std::vector<std::vector<size_t>> masks4D = {
+        {},
+        {1, 1, 1, 37},
+        {2, 1, 1, 37},
+        {2, 1, 16, 37},
+        {2, 4, 16, 37},
+        {16, 37},
+        {37},
+};
+
+const std::vector<std::vector<size_t>> masks3D = {
+        {},
+        {1, 1, 37},
+        {3, 1, 37},
+        {3, 7, 37},
+        {7, 1},
+};
+
+INSTANTIATE_TEST_CASE_P(ScaledDotProductAttentionNoMask, ScaledDotProductAttentionLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(queryShapes),
+                                ::testing::ValuesIn(keyLengths),
+                                ::testing::Values(true, false),
+                                ::testing::Values(std::vector<size_t>{})),
+                        ScaledDotProductAttentionLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(ScaledDotProductAttentionMask4D, ScaledDotProductAttentionLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{2, 4, 16, 32}),
+                                ::testing::Values(37),
+                                ::testing::Values(true, false),
+                                ::testing::ValuesIn(masks4D)),
+                        ScaledDotProductAttentionLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(ScaledDotProductAttentionMask3D, ScaledDotProductAttentionLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{3, 7, 24}),
+                                ::testing::Values(37),
+                                ::testing::Values(true, false),
+                                ::testing::ValuesIn(masks3D)),
+                        ScaledDotProductAttentionLayerCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+
+#include "ngraph/opsets/opset1.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#if !defined(_WIN32) && !defined(WIN32)
+#include <dirent.h>
+#include <unistd.h>
+
+using namespace InferenceEngine;
+
+namespace {
+
+InferenceEngine::CNNNetwork makeConvNetwork() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 8, 8});
+    std::vector<float> weightsData(32 * 16 * 3 * 3);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = static_cast<float>(i % 7) * 0.01f - 0.03f;
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{32, 16, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+            ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+    return InferenceEngine::CNNNetwork(function);
+}
+
+std::vector<std::string> listBlobs(const std::string& path) {
+    std::vector<std::string> files;
+    if (DIR* dir = opendir(path.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name.size() > 5 && name.compare(name.size() - 5, 5, ".blob") == 0)
+                files.push_back(name);
+        }
+        closedir(dir);
+    }
+    return files;
+}
+
+class CPUWeightsCacheDirTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/cpu_weights_cache_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        cacheDir = dirTemplate;
+    }
+
+    void TearDown() override {
+        for (const auto& file : listBlobs(cacheDir))
+            std::remove((cacheDir + "/" + file).c_str());
+        rmdir(cacheDir.c_str());
+    }
+
+    std::vector<float> infer(Core& ie, const CNNNetwork& network, const std::map<std::string, std::string>& config) {
+        auto execNetwork = ie.LoadNetwork(network, "CPU", config);
+        auto request = execNetwork.CreateInferRequest();
+        FuncTestUtils::fillInputsBySinValues(request.GetBlob(network.getInputsInfo().begin()->first));
+        request.Infer();
+
+        auto output = as<MemoryBlob>(request.GetBlob(network.getOutputsInfo().begin()->first));
+        auto outputMemory = output->rmap();
+        auto data = outputMemory.as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    }
+
+    std::string cacheDir;
+};
+
+}  // namespace
+
+// The store directory given to LoadNetwork only, not through SetConfig, is used
+TEST_F(CPUWeightsCacheDirTests, LoadNetworkConfigWritesStore) {
+    auto network = makeConvNetwork();
+    Core ie;
+
+    auto reference = infer(ie, network, {});
+    ASSERT_TRUE(listBlobs(cacheDir).empty());
+
+    auto cached = infer(ie, network, {{CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, cacheDir}});
+    ASSERT_FALSE(listBlobs(cacheDir).empty());
+    ASSERT_EQ(reference, cached);
+}
+
+// Weights loaded back from the store by a network with an empty in-memory cache give the same results
+TEST_F(CPUWeightsCacheDirTests, StoredWeightsAreReused) {
+    auto network = makeConvNetwork();
+    const std::map<std::string, std::string> config = {{CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, cacheDir}};
+
+    std::vector<float> first, second;
+    std::vector<std::string> storedFiles;
+    {
+        Core ie;
+        first = infer(ie, network, config);
+        storedFiles = listBlobs(cacheDir);
+    }
+    {
+        Core ie;
+        second = infer(ie, network, config);
+    }
+
+    ASSERT_FALSE(storedFiles.empty());
+    ASSERT_EQ(storedFiles.size(), listBlobs(cacheDir).size());
+    ASSERT_EQ(first, second);
+}
+
+#endif
@@ -167,6 +167,7 @@ using IEClassExecutableNetworkGetMetricTest_SUPPORTED_CONFIG_KEYS = IEClassBaseT
 using IEClassExecutableNetworkGetMetricTest_SUPPORTED_METRICS = IEClassBaseTestP;
 using IEClassExecutableNetworkGetMetricTest_NETWORK_NAME = IEClassBaseTestP;
 using IEClassExecutableNetworkGetMetricTest_OPTIMAL_NUMBER_OF_INFER_REQUESTS = IEClassBaseTestP;
+using IEClassExecutableNetworkGetMetricTest_MEMORY_USAGE = IEClassBaseTestP;
 using IEClassExecutableNetworkGetMetricTest_ThrowsUnsupported = IEClassBaseTestP;
 using IEClassExecutableNetworkGetConfigTest = IEClassBaseTestP;
 using IEClassExecutableNetworkSetConfigTest = IEClassBaseTestP;
@@ -911,6 +912,39 @@ TEST_P(IEClassExecutableNetworkGetMetricTest_OPTIMAL_NUMBER_OF_INFER_REQUESTS, G
     ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
 }
 
+TEST_P(IEClassExecutableNetworkGetMetricTest_MEMORY_USAGE, GetMetricNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    Core ie;
+    Parameter p;
+
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(simpleNetwork, deviceName);
+    InferRequest request = exeNetwork.CreateInferRequest();
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(MEMORY_USAGE)));
+    std::map<std::string, uint64_t> usage = p;
+
+    std::cout << "Memory usage: " << std::endl;
+    for (auto &&category : usage) {
+        std::cout << category.first << ": " << category.second << std::endl;
+    }
+    ASSERT_NE(usage.find("total"), usage.end());
+    ASSERT_GT(usage["total"], 0u);
+
+    // per stream and per request values are a breakdown of the top level categories
+    uint64_t categoriesSum = 0;
+    for (auto &&category : usage) {
+        if (category.first != "total" && category.first.find('.') == std::string::npos)
+            categoriesSum += category.second;
+    }
+    ASSERT_EQ(usage["total"], categoriesSum);
+    ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(MEMORY_USAGE));
+
+    ASSERT_NO_THROW(p = ie.GetMetric(deviceName, METRIC_KEY(MEMORY_USAGE)));
+    std::map<std::string, uint64_t> deviceUsage = p;
+    ASSERT_GE(deviceUsage["total"], usage["total"]);
+    ASSERT_METRIC_SUPPORTED(METRIC_KEY(MEMORY_USAGE));
+}
+
 TEST_P(IEClassExecutableNetworkGetMetricTest_ThrowsUnsupported, GetMetricThrow) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED();
     Core ie;
@@ -0,0 +1,221 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+#include <ie_system_conf.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32) && !defined(WIN32)
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+class MKLDNNWeightsCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        weights.resize(8 * 16);
+        std::iota(weights.begin(), weights.end(), 0.f);
+        dataKey = MKLDNNWeightsSharing::GetDataKey(weights.data(), weights.size() * sizeof(float), srcDesc);
+    }
+
+    std::function<MKLDNNMemoryPtr(void)> creator(const mkldnn::memory::desc& desc, int& calls) {
+        return [this, desc, &calls]() {
+            calls++;
+            MKLDNNMemoryPtr memory(new MKLDNNMemory(eng));
+            memory->Create(desc);
+            std::memcpy(memory->GetData(), weights.data(), weights.size() * sizeof(float));
+            return memory;
+        };
+    }
+
+    mkldnn::engine eng{mkldnn::engine::cpu, 0};
+    mkldnn::memory::desc oiDesc{{8, 16}, mkldnn::memory::f32, mkldnn::memory::oi};
+    mkldnn::memory::desc ioDesc{{8, 16}, mkldnn::memory::f32, mkldnn::memory::io};
+    InferenceEngine::TensorDesc srcDesc{InferenceEngine::Precision::FP32, {8, 16}, InferenceEngine::Layout::NC};
+    std::vector<float> weights;
+    std::string dataKey;
+};
+
+TEST_F(MKLDNNWeightsCacheTest, ReturnsCachedMemoryForSameDataAndLayout) {
+    MKLDNNWeightsSharing cache;
+    int calls = 0;
+
+    auto first = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    auto second = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(first, second);
+}
+
+TEST_F(MKLDNNWeightsCacheTest, CreatesNewMemoryForOtherLayout) {
+    MKLDNNWeightsSharing cache;
+    int calls = 0;
+
+    auto oi = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    auto io = cache.findOrCreate(dataKey, eng, ioDesc, creator(ioDesc, calls));
+
+    ASSERT_EQ(2, calls);
+    ASSERT_NE(oi, io);
+}
+
+TEST_F(MKLDNNWeightsCacheTest, CreatesNewMemoryForOtherData) {
+    MKLDNNWeightsSharing cache;
+    int calls = 0;
+
+    auto first = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    weights[0] = -1.f;
+    const std::string otherKey = MKLDNNWeightsSharing::GetDataKey(weights.data(), weights.size() * sizeof(float), srcDesc);
+    auto second = cache.findOrCreate(otherKey, eng, oiDesc, creator(oiDesc, calls));
+
+    ASSERT_NE(dataKey, otherKey);
+    ASSERT_EQ(2, calls);
+    ASSERT_NE(first, second);
+}
+
+TEST_F(MKLDNNWeightsCacheTest, CreatesNewMemoryForSameDataOfOtherSourceLayout) {
+    MKLDNNWeightsSharing cache;
+    int calls = 0;
+    const auto size = weights.size() * sizeof(float);
+
+    // Same bytes are other weights if they are interpreted with other dims, layout or precision
+    const std::vector<InferenceEngine::TensorDesc> otherDescs = {
+        {InferenceEngine::Precision::FP32, {16, 8}, InferenceEngine::Layout::NC},
+        {InferenceEngine::Precision::FP32, {8, 16}, InferenceEngine::Layout::CN},
+        {InferenceEngine::Precision::FP32, {8, 16, 1, 1}, InferenceEngine::Layout::NCHW},
+        {InferenceEngine::Precision::FP32, {8, 16, 1, 1}, InferenceEngine::Layout::NHWC},
+        {InferenceEngine::Precision::I32, {8, 16}, InferenceEngine::Layout::NC},
+    };
+    auto first = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    std::vector<std::string> keys = {dataKey};
+    for (const auto& desc : otherDescs) {
+        const auto key = MKLDNNWeightsSharing::GetDataKey(weights.data(), size, desc);
+        for (const auto& other : keys)
+            ASSERT_NE(other, key);
+        keys.push_back(key);
+        ASSERT_NE(first, cache.findOrCreate(key, eng, oiDesc, creator(oiDesc, calls)));
+    }
+    ASSERT_EQ(1 + static_cast<int>(otherDescs.size()), calls);
+
+    // while equal source is still shared
+    ASSERT_EQ(dataKey, MKLDNNWeightsSharing::GetDataKey(weights.data(), size, srcDesc));
+}
+
+TEST_F(MKLDNNWeightsCacheTest, RecreatesExpiredMemory) {
+    MKLDNNWeightsSharing cache;
+    int calls = 0;
+
+    cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    // Cache holds weak references only, nobody keeps the first copy alive
+    auto second = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+
+    ASSERT_EQ(2, calls);
+    ASSERT_NE(nullptr, second);
+}
+
+TEST(MKLDNNNumaNodesWeightsTest, SharesCachePerStoreDir) {
+    NumaNodesWeights numaNodesWeights;
+    const int numaNode = InferenceEngine::getAvailableNUMANodes().front();
+
+    ASSERT_EQ(numaNodesWeights[numaNode], numaNodesWeights.get(numaNode, ""));
+    ASSERT_EQ(numaNodesWeights.get(numaNode, "dir_a"), numaNodesWeights.get(numaNode, "dir_a"));
+    ASSERT_NE(numaNodesWeights.get(numaNode, "dir_a"), numaNodesWeights.get(numaNode, "dir_b"));
+    ASSERT_NE(numaNodesWeights[numaNode], numaNodesWeights.get(numaNode, "dir_a"));
+}
+
+#if !defined(_WIN32) && !defined(WIN32)
+
+class MKLDNNWeightsStoreTest : public MKLDNNWeightsCacheTest {
+protected:
+    void SetUp() override {
+        MKLDNNWeightsCacheTest::SetUp();
+        char dirTemplate[] = "/tmp/mkldnn_weights_store_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        storeDir = dirTemplate;
+    }
+
+    void TearDown() override {
+        for (const auto& file : listStore())
+            std::remove((storeDir + "/" + file).c_str());
+        rmdir(storeDir.c_str());
+    }
+
+    std::vector<std::string> listStore() const {
+        std::vector<std::string> files;
+        if (DIR* dir = opendir(storeDir.c_str())) {
+            while (dirent* entry = readdir(dir)) {
+                std::string name = entry->d_name;
+                if (name != "." && name != "..")
+                    files.push_back(name);
+            }
+            closedir(dir);
+        }
+        return files;
+    }
+
+    std::string storeDir;
+};
+
+TEST_F(MKLDNNWeightsStoreTest, SpillsCreatedMemoryToStore) {
+    MKLDNNWeightsSharing cache(storeDir);
+    int calls = 0;
+
+    auto memory = cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+
+    ASSERT_EQ(1, calls);
+    auto files = listStore();
+    ASSERT_EQ(1, files.size());
+    ASSERT_EQ(".blob", files[0].substr(files[0].size() - 5));
+    ASSERT_EQ(0, std::memcmp(memory->GetData(), weights.data(), weights.size() * sizeof(float)));
+}
+
+TEST_F(MKLDNNWeightsStoreTest, LoadsMemoryFromStoreOfOtherCache) {
+    int calls = 0;
+    {
+        MKLDNNWeightsSharing producer(storeDir);
+        producer.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    }
+
+    // Another process starts with an empty in-memory cache over the same directory
+    MKLDNNWeightsSharing consumer(storeDir);
+    auto memory = consumer.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(0, std::memcmp(memory->GetData(), weights.data(), weights.size() * sizeof(float)));
+}
+
+TEST_F(MKLDNNWeightsStoreTest, DoesNotLoadEntryOfOtherLayout) {
+    int calls = 0;
+    {
+        MKLDNNWeightsSharing producer(storeDir);
+        producer.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+    }
+
+    MKLDNNWeightsSharing consumer(storeDir);
+    consumer.findOrCreate(dataKey, eng, ioDesc, creator(ioDesc, calls));
+
+    ASSERT_EQ(2, calls);
+    ASSERT_EQ(2, listStore().size());
+}
+
+TEST_F(MKLDNNWeightsStoreTest, InProcessCacheDoesNotWriteStore) {
+    MKLDNNWeightsSharing cache;
+    int calls = 0;
+
+    cache.findOrCreate(dataKey, eng, oiDesc, creator(oiDesc, calls));
+
+    ASSERT_TRUE(listStore().empty());
+}
+
+#endif
@@ -0,0 +1,115 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+#include <ie_parallel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// Keeps the calling thread busy, so it retires instructions and spends cycles
+uint64_t spin(uint64_t iterations) {
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < iterations; i++)
+        sum = sum + i;
+    return sum;
+}
+
+}  // namespace
+
+TEST(PerfCountTest, AccumulatesNanosecondsAndReportsAvgInMicroseconds) {
+    PerfCount counter;
+    ASSERT_EQ(0u, counter.avg());
+    ASSERT_EQ(0.0, counter.avgNs());
+
+    for (int i = 0; i < 2; i++) {
+        PerfHelper helper(counter);
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+
+    // sub-microsecond parts are kept in the sum and truncated only by avg()
+    ASSERT_GE(counter.avg(), 3000u);
+    ASSERT_GE(counter.avgNs(), counter.avg() * 1000.0);
+    ASSERT_LT(counter.avgNs(), (counter.avg() + 1) * 1000.0);
+}
+
+TEST(PerfCountTest, HwCountersAreZeroWithoutThreads) {
+    HwCounters hw(4);
+    spin(1000000);
+
+    const auto values = hw.read();
+    ASSERT_EQ(0u, values.cycles);
+    ASSERT_EQ(0u, values.instructions);
+    ASSERT_EQ(0u, values.llcMisses);
+}
+
+TEST(PerfCountTest, HwCountersGrowWithWorkOfAddedThread) {
+    HwCounters hw(4);
+    hw.addCurrentThread();
+    // repeated joins are ignored
+    hw.addCurrentThread();
+
+    const auto before = hw.read();
+    spin(1000000);
+    const auto after = hw.read();
+    if (after.cycles == 0)
+        GTEST_SKIP() << "perf_event_open is not permitted";
+
+    ASSERT_GT(after.cycles, before.cycles);
+    ASSERT_GT(after.instructions, before.instructions + 1000000u);
+}
+
+TEST(PerfCountTest, HwCountersIgnoreThreadsOverCapacity) {
+    HwCounters hw(1);
+    hw.addCurrentThread();
+    if (hw.read().cycles == 0)
+        GTEST_SKIP() << "perf_event_open is not permitted";
+
+    std::atomic<bool> added {false};
+    std::atomic<bool> done {false};
+    std::thread other([&] {
+        hw.addCurrentThread();
+        added = true;
+        while (!done)
+            spin(1000);
+    });
+    while (!added)
+        std::this_thread::yield();
+
+    // the other thread spins meanwhile, but only the calling thread is counted
+    const auto before = hw.read();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const auto after = hw.read();
+    done = true;
+    other.join();
+
+    ASSERT_LT(after.instructions - before.instructions, 1000000u);
+}
+
+TEST(PerfCountTest, PerfHelperAccumulatesHwCountersOfStreamThreads) {
+    HwCounters hw(parallel_get_max_threads() + std::thread::hardware_concurrency() + 1);
+    hw.addCurrentStreamThreads();
+
+    PerfCount counter;
+    {
+        PerfHelper helper(counter, &hw);
+        InferenceEngine::parallel_nt(0, [](const int, const int) {
+            spin(1000000);
+        });
+    }
+
+    const auto avg = counter.avgHw();
+    if (avg.cycles == 0)
+        GTEST_SKIP() << "perf_event_open is not permitted";
+    ASSERT_GT(avg.instructions, 1000000u);
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <convert_function_to_cnn_network.hpp>
+#include <cpp/ie_cnn_network.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace InferenceEngine;
+
+// Benchmark, run with --gtest_also_run_disabled_tests. The time is printed and recorded as a test property.
+TEST(ConvertFunctionToCNNNetworkTests, DISABLED_ConvertLargeNetworkTime) {
+    const size_t layersNum = 2000;
+    const int runsNum = 10;
+
+    auto makeFunction = [&] {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        std::shared_ptr<ngraph::Node> last = param;
+        for (size_t i = 0; i < layersNum; i++) {
+            auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 16},
+                                                             std::vector<float>(16, static_cast<float>(i)));
+            constant->set_friendly_name("const_" + std::to_string(i));
+            last = std::make_shared<ngraph::opset1::Add>(last, constant);
+            last->set_friendly_name("add_" + std::to_string(i));
+        }
+        auto result = std::make_shared<ngraph::op::Result>(last);
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+    };
+
+    // The best of several runs, each converts a new function, so names are never cached by the previous run
+    std::chrono::microseconds best = std::chrono::microseconds::max();
+    for (int run = 0; run < runsNum; run++) {
+        auto f = makeFunction();
+        CNNNetwork nGraphImpl(f);
+        const auto start = std::chrono::steady_clock::now();
+        auto net = details::convertFunctionToICNNNetwork(f, nGraphImpl);
+        const auto finish = std::chrono::steady_clock::now();
+        ASSERT_EQ(1 + 2 * layersNum, net->layerCount());
+        best = std::min(best, std::chrono::duration_cast<std::chrono::microseconds>(finish - start));
+    }
+
+    RecordProperty("layers", static_cast<int>(2 * layersNum + 1));
+    RecordProperty("convert_us", static_cast<int>(best.count()));
+    std::cout << "convertFunctionToICNNNetwork of " << 2 * layersNum + 1 << " layers: "
+              << best.count() << " us" << std::endl;
+}
@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "pooled_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class PooledAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        allocator.reset(new PooledMemoryAllocator());
+    }
+
+    void TearDown() override {
+        allocator.reset();
+        PooledMemoryAllocator::trim();
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    std::unique_ptr<PooledMemoryAllocator> allocator;
+};
+
+TEST_F(PooledAllocatorTests, canAllocateAlignedMemoryOfDifferentSizes) {
+    const std::vector<size_t> sizes = {0, 1, 64, 65, 129, 1000, 300 * 1024, 3 * 1024 * 1024, 64 * 1024 * 1024 + 1};
+    for (auto size : sizes) {
+        void *handle = allocator->alloc(size);
+        ASSERT_NE(handle, nullptr) << "size: " << size;
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(handle) % 64, 0) << "size: " << size;
+        char *ptr = reinterpret_cast<char *>(allocator->lock(handle));
+        if (size) {
+            std::memset(ptr, 11, size);
+            EXPECT_EQ(ptr[size - 1], 11);
+        }
+        allocator->unlock(ptr);
+        EXPECT_TRUE(allocator->free(handle));
+    }
+}
+
+TEST_F(PooledAllocatorTests, canFreeNullptr) {
+    EXPECT_TRUE(allocator->free(nullptr));
+}
+
+TEST_F(PooledAllocatorTests, reusesFreedBlockOfTheSameSizeClass) {
+    void *handle0 = allocator->alloc(1000);
+    allocator->free(handle0);
+    auto before = PooledMemoryAllocator::getStatistics();
+    void *handle1 = allocator->alloc(990);
+    auto after = PooledMemoryAllocator::getStatistics();
+    EXPECT_EQ(handle0, handle1);
+    EXPECT_EQ(after.poolHits - before.poolHits, 1u);
+    allocator->free(handle1);
+}
+
+TEST_F(PooledAllocatorTests, countersTrackAllocations) {
+    auto before = PooledMemoryAllocator::getStatistics();
+    std::vector<void *> handles;
+    for (size_t i = 1; i <= 10; i++) {
+        handles.push_back(allocator->alloc(i * 100));
+    }
+    auto allocated = PooledMemoryAllocator::getStatistics();
+    EXPECT_EQ(allocated.allocations - before.allocations, 10u);
+    EXPECT_GE(allocated.bytesInUse - before.bytesInUse, 5500u);
+
+    for (auto handle : handles) {
+        allocator->free(handle);
+    }
+    auto freed = PooledMemoryAllocator::getStatistics();
+    EXPECT_EQ(freed.deallocations - before.deallocations, 10u);
+    EXPECT_EQ(freed.bytesInUse, before.bytesInUse);
+}
+
+TEST_F(PooledAllocatorTests, canBeUsedConcurrently) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([this] {
+            std::vector<void *> handles;
+            for (size_t i = 0; i < 1000; i++) {
+                void *handle = allocator->alloc(i * 37 % 5000 + 1);
+                ASSERT_NE(handle, nullptr);
+                handles.push_back(handle);
+                if (handles.size() > 8) {
+                    allocator->free(handles.front());
+                    handles.erase(handles.begin());
+                }
+            }
+            for (auto handle : handles) {
+                allocator->free(handle);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_F(PooledAllocatorTests, threadCacheIsBounded) {
+    const size_t threadCacheLimit = 4 * 1024 * 1024;
+    auto before = PooledMemoryAllocator::getStatistics();
+    std::thread([&] {
+        std::vector<void *> handles;
+        for (size_t size : {64 * 1024, 96 * 1024, 128 * 1024, 192 * 1024, 256 * 1024}) {
+            for (int i = 0; i < 16; i++) {
+                handles.push_back(allocator->alloc(size));
+                ASSERT_NE(handles.back(), nullptr);
+            }
+        }
+        for (auto handle : handles) {
+            allocator->free(handle);
+        }
+        auto freed = PooledMemoryAllocator::getStatistics();
+        EXPECT_GT(freed.bytesThreadCached, before.bytesThreadCached);
+        EXPECT_LE(freed.bytesThreadCached - before.bytesThreadCached, threadCacheLimit);
+    }).join();
+}
+
+TEST_F(PooledAllocatorTests, threadCacheIsReclaimedOnThreadExit) {
+    auto before = PooledMemoryAllocator::getStatistics();
+    void *threadHandle = nullptr;
+    std::thread([&] {
+        threadHandle = allocator->alloc(1000);
+        allocator->free(threadHandle);
+        EXPECT_GT(PooledMemoryAllocator::getStatistics().bytesThreadCached, before.bytesThreadCached);
+    }).join();
+
+    auto exited = PooledMemoryAllocator::getStatistics();
+    EXPECT_EQ(exited.bytesThreadCached, before.bytesThreadCached);
+    EXPECT_GT(exited.bytesCached, before.bytesCached);
+
+    // The block of the exited thread is reused by the current one
+    PooledMemoryAllocator::trim();
+    void *handle = nullptr;
+    std::thread([&] {
+        threadHandle = allocator->alloc(1000);
+        allocator->free(threadHandle);
+    }).join();
+    handle = allocator->alloc(1000);
+    EXPECT_EQ(handle, threadHandle);
+    allocator->free(handle);
+}
+
+TEST_F(PooledAllocatorTests, trimReleasesCachesOfOtherThreads) {
+    std::promise<void> cached, trimmed;
+    auto before = PooledMemoryAllocator::getStatistics();
+    std::thread thread([&] {
+        allocator->free(allocator->alloc(1000));
+        cached.set_value();
+        trimmed.get_future().wait();
+
+        auto beforeAlloc = PooledMemoryAllocator::getStatistics();
+        void *handle = allocator->alloc(1000);
+        auto afterAlloc = PooledMemoryAllocator::getStatistics();
+        EXPECT_EQ(afterAlloc.poolHits, beforeAlloc.poolHits);
+        EXPECT_EQ(afterAlloc.bytesThreadCached, before.bytesThreadCached);
+        allocator->free(handle);
+    });
+
+    cached.get_future().wait();
+    EXPECT_GT(PooledMemoryAllocator::getStatistics().bytesThreadCached, before.bytesThreadCached);
+    PooledMemoryAllocator::trim();
+    trimmed.set_value();
+    thread.join();
+}
+
+TEST_F(PooledAllocatorTests, defaultAllocatorIsPooled) {
+    std::shared_ptr<IAllocator> defaultAllocator = details::shared_from_irelease(CreateDefaultAllocator());
+    ASSERT_NE(std::dynamic_pointer_cast<PooledMemoryAllocator>(defaultAllocator), nullptr);
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public CommonTestUtils::TestsCommon {
+protected:
+    static uint32_t bits(float value) {
+        uint32_t result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+};
+
+// Array conversions are vectorized depending on CPU, their results must match the scalar ones bit by bit.
+// Default zero bias is still added, so negative zero becomes positive one in both versions.
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysMatchesScalarForAllValues) {
+    // Odd size to cover a tail which is not a multiple of vector length
+    std::vector<ie_fp16> src(0xFFFF);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(bits(PrecisionUtils::f16tof32(src[i]) + 0.f), bits(dst[i])) << "f16 value 0x" << std::hex << i;
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysMatchesScalar) {
+    std::vector<float> src = {
+        0.f, -0.f, 1.f, -1.f, 0.5f, 65504.f, 65519.f, 65520.f, -65520.f, 1e10f, -1e10f,
+        6.1035156e-05f, 6.0975552e-05f, 5.9604645e-08f, 2.9802322e-08f, 2.9802326e-08f, 1e-10f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min()
+    };
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> dist;
+    for (size_t i = 0; i < 100003; i++) {
+        uint32_t value = dist(gen);
+        float f;
+        std::memcpy(&f, &value, sizeof(f));
+        src.push_back(f);
+    }
+
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] + 0.f), dst[i]) << "f32 value 0x" << std::hex << bits(src[i]);
+}
+
+// Scale and bias are applied with two roundings, as in the scalar code, not with a fused multiply-add
+TEST_F(PrecisionUtilsTests, f16tof32ArraysMatchesScalarWithScaleAndBias) {
+    const float scale = 0.37f, bias = -1.3f;
+    std::vector<ie_fp16> src(0xFFFF);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), scale, bias);
+
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(bits(PrecisionUtils::f16tof32(src[i]) * scale + bias), bits(dst[i])) << "f16 value 0x" << std::hex << i;
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysMatchesScalarWithScaleAndBias) {
+    const float scale = 1.7f, bias = 0.3f;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> values(-40000.f, 40000.f);
+    std::uniform_real_distribution<float> smallValues(-1e-3f, 1e-3f);
+    std::vector<float> src;
+    for (size_t i = 0; i < 100003; i++)
+        src.push_back(i % 2 ? values(gen) : smallValues(gen));
+
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size(), scale, bias);
+
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * scale + bias), dst[i]) << "f32 value " << src[i];
+}
+
+// Sizes around the AVX2 and AVX-512 vector lengths, elements after nelem must stay untouched
+TEST_F(PrecisionUtilsTests, arraysConvertTailOfOddSize) {
+    const float scale = 2.f, bias = 1.f;
+    const ie_fp16 guard16 = 0x7E00;
+    const float guard32 = -12345.f;
+    for (size_t nelem = 1; nelem <= 49; nelem += 2) {
+        std::vector<float> src32(nelem + 1, guard32);
+        std::vector<ie_fp16> src16(nelem + 1, guard16);
+        for (size_t i = 0; i < nelem; i++) {
+            src32[i] = static_cast<float>(i) + 0.25f;
+            src16[i] = PrecisionUtils::f32tof16(static_cast<float>(i) - 0.5f);
+        }
+
+        std::vector<ie_fp16> dst16(nelem + 1, guard16);
+        PrecisionUtils::f32tof16Arrays(dst16.data(), src32.data(), nelem, scale, bias);
+        for (size_t i = 0; i < nelem; i++)
+            ASSERT_EQ(PrecisionUtils::f32tof16(src32[i] * scale + bias), dst16[i]) << "nelem " << nelem << ", element " << i;
+        ASSERT_EQ(guard16, dst16[nelem]) << "nelem " << nelem;
+
+        std::vector<float> dst32(nelem + 1, guard32);
+        PrecisionUtils::f16tof32Arrays(dst32.data(), src16.data(), nelem, scale, bias);
+        for (size_t i = 0; i < nelem; i++)
+            ASSERT_EQ(bits(PrecisionUtils::f16tof32(src16[i]) * scale + bias), bits(dst32[i])) << "nelem " << nelem << ", element " << i;
+        ASSERT_EQ(bits(guard32), bits(dst32[nelem])) << "nelem " << nelem;
+    }
+}
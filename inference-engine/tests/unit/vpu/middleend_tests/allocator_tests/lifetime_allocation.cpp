@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/allocator/lifetime_planner.hpp>
+
+#include <random>
+
+namespace vpu {
+
+using namespace allocator;
+
+namespace {
+
+Lifetime makeLifetime(int begin, int end, int size) {
+    Lifetime lifetime;
+    lifetime.begin = begin;
+    lifetime.end = end;
+    lifetime.size = size;
+    return lifetime;
+}
+
+bool overlaps(int lhsOffset, int lhsSize, int rhsOffset, int rhsSize) {
+    return lhsOffset < rhsOffset + rhsSize && rhsOffset < lhsOffset + lhsSize;
+}
+
+}  // namespace
+
+TEST(LifetimePlannerTests, PlacesIntersectingLifetimesApart) {
+    std::mt19937 gen(42);
+
+    for (int iter = 0; iter < 100; ++iter) {
+        std::vector<Lifetime> lifetimes;
+        for (int i = 0; i < 50; ++i) {
+            const auto begin = static_cast<int>(gen() % 100);
+            lifetimes.push_back(makeLifetime(begin, begin + 1 + gen() % 20, DATA_ALIGNMENT * (1 + gen() % 16)));
+        }
+
+        const auto totalSize = planLifetimes(lifetimes);
+        ASSERT_GE(totalSize, lifetimesLowerBound(lifetimes));
+
+        for (size_t i = 0; i < lifetimes.size(); ++i) {
+            const auto& lhs = lifetimes[i];
+            ASSERT_GE(lhs.offset, 0);
+            ASSERT_LE(lhs.offset + lhs.size, totalSize);
+
+            for (size_t j = i + 1; j < lifetimes.size(); ++j) {
+                const auto& rhs = lifetimes[j];
+                if (intersects(lhs, rhs)) {
+                    ASSERT_FALSE(overlaps(lhs.offset, lhs.size, rhs.offset, rhs.size)) << i << " and " << j;
+                }
+            }
+        }
+    }
+}
+
+TEST(LifetimePlannerTests, ReusesMemoryOfFinishedLifetimes) {
+    std::vector<Lifetime> lifetimes = {
+        makeLifetime(0, 2, 64),
+        makeLifetime(1, 4, 128),
+        makeLifetime(3, 6, 128),
+        makeLifetime(5, 7, 64),
+    };
+
+    ASSERT_EQ(planLifetimes(lifetimes), 256);
+    ASSERT_EQ(lifetimesLowerBound(lifetimes), 256);
+}
+
+class LifetimeAllocationTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _testModel = CreateTestModel();
+    }
+
+    int runAllocation(bool enableLifetimeAllocation) {
+        config.enableLifetimeAllocation = enableLifetimeAllocation;
+        CompileEnv::updateConfig(config);
+
+        const auto& model = _testModel.getBaseModel();
+        const auto result = runAllocator(model);
+        EXPECT_EQ(result.status, AllocationStatus::OK);
+
+        model->getAllocator().selfCheck();
+
+        return model->getAllocator().usedMemoryAmount().BSS;
+    }
+
+    void checkStagesData() {
+        for (const auto& stage : _testModel.getBaseModel()->getStages()) {
+            DataVector datas;
+            for (const auto& data : stage->inputs()) {
+                datas.push_back(data);
+            }
+            for (const auto& data : stage->outputs()) {
+                datas.push_back(data);
+            }
+
+            for (size_t i = 0; i < datas.size(); ++i) {
+                for (size_t j = i + 1; j < datas.size(); ++j) {
+                    const auto& lhs = datas[i];
+                    const auto& rhs = datas[j];
+                    if (lhs->dataLocation().location != Location::BSS || rhs->dataLocation().location != Location::BSS) {
+                        continue;
+                    }
+
+                    ASSERT_FALSE(overlaps(lhs->dataLocation().offset, calcAllocationSize(lhs),
+                                          rhs->dataLocation().offset, calcAllocationSize(rhs)))
+                        << lhs->name() << " and " << rhs->name() << " at " << stage->name();
+                }
+            }
+        }
+    }
+
+protected:
+    TestModel _testModel;
+};
+
+TEST_F(LifetimeAllocationTests, ReducesFragmentedBSS) {
+    //
+    //                    -> [Small] -> (Stage) -> [Large] ----------------
+    // [Input] -> (Stage)                            |                     |
+    //                    -> [Large] ------------> (Stage) -> [Small] -> (Stage) -> [Output]
+    //
+    // Greedy allocation can't reuse the memory of the first small data for the second one,
+    // the lifetime allocation places both small datas after the large ones.
+    //
+
+    const DataDesc desc{64};
+
+    _testModel.createInputs({desc});
+    _testModel.createOutputs({desc});
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(DataDesc{32}),
+                                                     OutputInfo::intermediate(DataDesc{512})});
+    _testModel.addStage({InputInfo::fromPrevStage(0).output(0)}, {OutputInfo::intermediate(DataDesc{512})});
+    _testModel.addStage({InputInfo::fromPrevStage(0).output(1), InputInfo::fromPrevStage(1).output(0)},
+                        {OutputInfo::intermediate(DataDesc{64})});
+    _testModel.addStage({InputInfo::fromPrevStage(1).output(0), InputInfo::fromPrevStage(2).output(0)},
+                        {OutputInfo::fromNetwork()});
+
+    const auto greedyBSS = runAllocation(false);
+    ASSERT_NO_FATAL_FAILURE(checkStagesData());
+
+    const auto lifetimeBSS = runAllocation(true);
+    ASSERT_NO_FATAL_FAILURE(checkStagesData());
+
+    const auto report = _testModel.getBaseModel()->getAllocator().memoryReport(MemoryType::DDR);
+    ASSERT_EQ(report.used, lifetimeBSS);
+    ASSERT_EQ(report.lowerBound, lifetimeBSS);
+    ASSERT_LT(lifetimeBSS, greedyBSS);
+}
+
+}  // namespace vpu
@@ -0,0 +1,87 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+using namespace HWTilingNS;
+
+class HWConvTilingCacheTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        config.hwOptimization = true;
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static ConvolutionOptions makeOptions(const std::string& name, int width, int height, int channels,
+                                          int kernelSize, int pad) {
+        DimValues inputDims;
+        inputDims.set(Dim::W, width);
+        inputDims.set(Dim::H, height);
+        inputDims.set(Dim::C, channels);
+        inputDims.set(Dim::N, 1);
+
+        DimValues outputDims = inputDims;
+        outputDims.set(Dim::W, width + 2 * pad - kernelSize + 1);
+        outputDims.set(Dim::H, height + 2 * pad - kernelSize + 1);
+
+        return ConvolutionOptions{name, inputDims, outputDims, outputDims,
+                                  kernelSize, kernelSize, 1, pad, pad, pad, pad, false};
+    }
+
+    static void compare(const std::vector<TilingOption>& expected, const std::vector<TilingOption>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(expected[i].numWidthTiles, actual[i].numWidthTiles);
+            ASSERT_EQ(expected[i].numHeightTiles, actual[i].numHeightTiles);
+            ASSERT_EQ(expected[i].numChannelTiles, actual[i].numChannelTiles);
+            ASSERT_DOUBLE_EQ(expected[i].cost, actual[i].cost);
+        }
+    }
+};
+
+TEST_F(HWConvTilingCacheTests, SameOptionsAsSearchWithoutCache) {
+    const auto direction = Direction::INPUT_TO_OUTPUT;
+    const size_t maxTilingOptions = 5;
+
+    const std::vector<ConvolutionOptions> options = {
+        makeOptions("conv1", 224, 224, 64, 3, 1),
+        makeOptions("conv2", 56, 56, 256, 1, 0),
+        makeOptions("conv3", 224, 224, 64, 3, 1),
+        makeOptions("conv4", 28, 28, 512, 3, 1),
+    };
+
+    HWConvolutionTilingCache cache(CompileEnv::get().resources.numCMXSlices);
+    cache.search(options, direction, maxTilingOptions);
+
+    // conv1 and conv3 differ by name only
+    ASSERT_EQ(cache.size(), 3u);
+
+    for (const auto& convOptions : options) {
+        const HWConvolutionTilingSearcher searcher(convOptions, direction, maxTilingOptions);
+        const HWConvolutionTilingSearcher cachedSearcher(convOptions, direction, maxTilingOptions, &cache);
+        ASSERT_FALSE(searcher.tilingOptions().empty()) << convOptions._stageName;
+        ASSERT_NO_FATAL_FAILURE(compare(searcher.tilingOptions(), cachedSearcher.tilingOptions()));
+    }
+
+    ASSERT_EQ(cache.size(), 3u);
+}
+
+TEST_F(HWConvTilingCacheTests, SearchesMissingOptionsOnLookup) {
+    const auto direction = Direction::INPUT_TO_OUTPUT;
+    const auto convOptions = makeOptions("conv", 56, 56, 128, 3, 1);
+
+    HWConvolutionTilingCache cache(CompileEnv::get().resources.numCMXSlices);
+    const HWConvolutionTiler tiler(convOptions, direction, 1, &cache);
+
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_TRUE(tiler.isTilingPossible());
+    ASSERT_EQ(tiler.getHwTilings().size(), 1u);
+}
+
+}  // namespace vpu
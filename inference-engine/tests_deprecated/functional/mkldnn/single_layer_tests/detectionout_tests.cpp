@@ -5,6 +5,11 @@
 #include <gtest/gtest.h>
 #include <ie_core.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
 #include "tests_common.hpp"
 #include "single_layer_common.hpp"
 
@@ -187,3 +192,318 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 detectionout_test_params{ "CPU",
                     10, {147264}, {147264}, {2, 1, 147264}, {1, 200, 7} }));
+
+struct detectionout_ref_test_params {
+    size_t mb;
+    int num_priors;
+    int num_classes;
+    bool share_location;
+    bool decrease_label_id;
+    int top_k;
+    int keep_top_k;
+    float confidence_threshold;
+    float nms_threshold;
+};
+
+static bool ref_score_index_descend(const std::pair<float, int> &a, const std::pair<float, int> &b) {
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+// Straightforward DetectionOutput for CENTER_SIZE code type with variances in priors:
+// decodes every prior and runs NMS over all of them
+static std::vector<std::array<float, 7>> ref_detectionout(const detectionout_ref_test_params &p,
+                                                          const float *loc, const float *conf, const float *priors) {
+    const int N = static_cast<int>(p.mb);
+    const int P = p.num_priors;
+    const int C = p.num_classes;
+    const int L = p.share_location ? 1 : C;
+    const int background = 0;
+
+    std::vector<std::array<float, 7>> dst;
+    std::vector<float> boxes(L * P * 4);
+    std::vector<float> sizes(L * P);
+
+    for (int n = 0; n < N; ++n) {
+        for (int l = 0; l < L; ++l) {
+            for (int prior = 0; prior < P; ++prior) {
+                const float *pr = priors + prior*4;
+                const float *var = priors + P*4 + prior*4;
+                const float *ploc = loc + n*P*L*4 + (prior*L + l)*4;
+
+                float prior_width    = pr[2] - pr[0];
+                float prior_height   = pr[3] - pr[1];
+                float prior_center_x = (pr[0] + pr[2]) / 2.0f;
+                float prior_center_y = (pr[1] + pr[3]) / 2.0f;
+
+                float center_x = var[0] * ploc[0] * prior_width + prior_center_x;
+                float center_y = var[1] * ploc[1] * prior_height + prior_center_y;
+                float width    = std::exp(var[2] * ploc[2]) * prior_width;
+                float height   = std::exp(var[3] * ploc[3]) * prior_height;
+
+                float *box = &boxes[(l*P + prior)*4];
+                box[0] = center_x - width  / 2.0f;
+                box[1] = center_y - height / 2.0f;
+                box[2] = center_x + width  / 2.0f;
+                box[3] = center_y + height / 2.0f;
+                sizes[l*P + prior] = (box[2] - box[0]) * (box[3] - box[1]);
+            }
+        }
+
+        auto overlap = [&](int l, int idx1, int idx2) {
+            const float *b1 = &boxes[(l*P + idx1)*4];
+            const float *b2 = &boxes[(l*P + idx2)*4];
+            if (b2[0] > b1[2] || b2[2] < b1[0] || b2[1] > b1[3] || b2[3] < b1[1])
+                return 0.0f;
+            float width  = (std::min)(b1[2], b2[2]) - (std::max)(b1[0], b2[0]);
+            float height = (std::min)(b1[3], b2[3]) - (std::max)(b1[1], b2[1]);
+            if (width <= 0 || height <= 0)
+                return 0.0f;
+            float intersect = width * height;
+            return intersect / (sizes[l*P + idx1] + sizes[l*P + idx2] - intersect);
+        };
+
+        auto suppress = [&](std::vector<int> &kept, int l, int idx) {
+            for (int kept_idx : kept) {
+                if (overlap(l, idx, kept_idx) > p.nms_threshold)
+                    return;
+            }
+            kept.push_back(idx);
+        };
+
+        std::vector<std::vector<int>> kept(C);
+        const float *pconf = conf + n*P*C;
+
+        if (!p.decrease_label_id) {
+            for (int c = 0; c < C; ++c) {
+                if (c == background)
+                    continue;
+                std::vector<std::pair<float, int>> scores;
+                for (int prior = 0; prior < P; ++prior) {
+                    if (pconf[prior*C + c] > p.confidence_threshold)
+                        scores.emplace_back(pconf[prior*C + c], prior);
+                }
+                std::stable_sort(scores.begin(), scores.end(), ref_score_index_descend);
+                if (p.top_k > -1 && static_cast<int>(scores.size()) > p.top_k)
+                    scores.resize(p.top_k);
+                for (const auto &score : scores)
+                    suppress(kept[c], p.share_location ? 0 : c, score.second);
+            }
+        } else {
+            std::vector<std::pair<float, int>> scores;
+            for (int prior = 0; prior < P; ++prior) {
+                float max_conf = -1;
+                int id = 0;
+                for (int c = 1; c < C; ++c) {
+                    if (pconf[prior*C + c] > max_conf) {
+                        max_conf = pconf[prior*C + c];
+                        id = c;
+                    }
+                }
+                if (id > 0 && max_conf >= p.confidence_threshold)
+                    scores.emplace_back(max_conf, id*P + prior);
+            }
+            std::stable_sort(scores.begin(), scores.end(), ref_score_index_descend);
+            if (p.top_k > -1 && static_cast<int>(scores.size()) > p.top_k)
+                scores.resize(p.top_k);
+            for (const auto &score : scores)
+                suppress(kept[score.second / P], 0, score.second % P);
+        }
+
+        size_t total = 0;
+        for (const auto &k : kept)
+            total += k.size();
+
+        if (p.keep_top_k > -1 && static_cast<int>(total) > p.keep_top_k) {
+            std::vector<std::pair<float, int>> scores;
+            for (int c = 0; c < C; ++c) {
+                for (int idx : kept[c])
+                    scores.emplace_back(pconf[idx*C + c], c*P + idx);
+            }
+            std::stable_sort(scores.begin(), scores.end(), ref_score_index_descend);
+            scores.resize(p.keep_top_k);
+            for (auto &k : kept)
+                k.clear();
+            for (const auto &score : scores)
+                kept[score.second / P].push_back(score.second % P);
+        }
+
+        for (int c = 0; c < C; ++c) {
+            const int l = p.share_location ? 0 : c;
+            for (int idx : kept[c]) {
+                const float *box = &boxes[(l*P + idx)*4];
+                dst.push_back({static_cast<float>(n), static_cast<float>(p.decrease_label_id ? c - 1 : c),
+                               pconf[idx*C + c], box[0], box[1], box[2], box[3]});
+            }
+        }
+    }
+
+    return dst;
+}
+
+class smoke_CPUDetectionOutRefTest: public TestsCommon,
+                                    public WithParamInterface<detectionout_ref_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="DetectionOutput_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_N_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" type="DetectionOutput" precision="FP32" id="11">
+            <data num_classes="_C_" share_location="_SHARE_" background_label_id="0" nms_threshold="_NMS_THR_"
+                  top_k="_TOP_K_" keep_top_k="_KEEP_TOP_K_" confidence_threshold="_CONF_THR_"
+                  code_type="caffe.PriorBoxParameter.CENTER_SIZE" variance_encoded_in_target="0"
+                  decrease_label_id="_DECREASE_" />
+            <input>
+                <port id="11">
+                    <dim>_N_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+                <port id="12">
+                    <dim>_N_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+                <port id="13">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="14">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_OH_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="11" to-port="11"/>
+        <edge from-layer="2" from-port="2" to-layer="11" to-port="12"/>
+        <edge from-layer="3" from-port="3" to-layer="11" to-port="13"/>
+    </edges>
+</Net>
+)V0G0N";
+
+protected:
+    std::string getModel(const detectionout_ref_test_params &p) {
+        std::string model = model_t;
+        const int num_loc_classes = p.share_location ? 1 : p.num_classes;
+
+        REPLACE_WITH_NUM(model, "_N_", p.mb);
+        REPLACE_WITH_NUM(model, "_LOC_", p.num_priors * num_loc_classes * 4);
+        REPLACE_WITH_NUM(model, "_CONF_", p.num_priors * p.num_classes);
+        REPLACE_WITH_NUM(model, "_PRIORS_", p.num_priors * 4);
+        REPLACE_WITH_NUM(model, "_C_", p.num_classes);
+        REPLACE_WITH_NUM(model, "_SHARE_", p.share_location ? 1 : 0);
+        REPLACE_WITH_NUM(model, "_DECREASE_", p.decrease_label_id ? 1 : 0);
+        REPLACE_WITH_NUM(model, "_TOP_K_", p.top_k);
+        REPLACE_WITH_NUM(model, "_KEEP_TOP_K_", p.keep_top_k);
+        REPLACE_WITH_NUM(model, "_CONF_THR_", p.confidence_threshold);
+        REPLACE_WITH_NUM(model, "_NMS_THR_", p.nms_threshold);
+        REPLACE_WITH_NUM(model, "_OH_", p.mb * p.keep_top_k);
+
+        return model;
+    }
+
+    static void fillInputs(std::mt19937 &gen, const detectionout_ref_test_params &p,
+                           Blob::Ptr loc, Blob::Ptr conf, Blob::Ptr priors) {
+        std::uniform_real_distribution<float> unit(0.f, 1.f);
+        std::uniform_real_distribution<float> offset(-1.f, 1.f);
+
+        float *ploc = loc->buffer().as<float *>();
+        for (size_t i = 0; i < loc->size(); ++i)
+            ploc[i] = offset(gen);
+
+        float *pconf = conf->buffer().as<float *>();
+        for (size_t i = 0; i < conf->size(); ++i)
+            pconf[i] = unit(gen);
+
+        float *ppriors = priors->buffer().as<float *>();
+        for (int i = 0; i < p.num_priors; ++i) {
+            float cx = unit(gen), cy = unit(gen);
+            float w = 0.05f + 0.3f * unit(gen), h = 0.05f + 0.3f * unit(gen);
+            ppriors[i*4 + 0] = cx - w / 2;
+            ppriors[i*4 + 1] = cy - h / 2;
+            ppriors[i*4 + 2] = cx + w / 2;
+            ppriors[i*4 + 3] = cy + h / 2;
+
+            float *pvariance = ppriors + p.num_priors*4 + i*4;
+            pvariance[0] = pvariance[1] = 0.1f;
+            pvariance[2] = pvariance[3] = 0.2f;
+        }
+    }
+};
+
+TEST_P(smoke_CPUDetectionOutRefTest, MatchesReferenceOnRepeatedInfer) {
+    detectionout_ref_test_params p = GetParam();
+
+    Core ie;
+    CNNNetwork network = ie.ReadNetwork(getModel(p), Blob::CPtr());
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(network, "CPU");
+    InferRequest inferRequest = exeNetwork.CreateInferRequest();
+
+    Blob::Ptr loc = inferRequest.GetBlob("loc");
+    Blob::Ptr conf = inferRequest.GetBlob("conf");
+    Blob::Ptr priors = inferRequest.GetBlob("priors");
+
+    // Different inputs on each run check that no state of the previous inference leaks into the next one
+    std::mt19937 gen(42);
+    for (int run = 0; run < 3; ++run) {
+        fillInputs(gen, p, loc, conf, priors);
+        inferRequest.Infer();
+
+        auto ref = ref_detectionout(p, loc->cbuffer().as<const float *>(), conf->cbuffer().as<const float *>(),
+                                    priors->cbuffer().as<const float *>());
+        ASSERT_FALSE(ref.empty());
+        ASSERT_LE(ref.size(), p.mb * p.keep_top_k);
+
+        Blob::Ptr out = inferRequest.GetBlob("detection_out");
+        const float *dst = out->cbuffer().as<const float *>();
+        for (size_t i = 0; i < ref.size(); ++i) {
+            for (size_t j = 0; j < 3; ++j)
+                ASSERT_EQ(ref[i][j], dst[i*7 + j]) << "run " << run << ", detection " << i << ", field " << j;
+            for (size_t j = 3; j < 7; ++j)
+                ASSERT_NEAR(ref[i][j], dst[i*7 + j], 1e-5f) << "run " << run << ", detection " << i << ", field " << j;
+        }
+        if (ref.size() < p.mb * p.keep_top_k)
+            ASSERT_EQ(-1.f, dst[ref.size() * 7]) << "run " << run;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutRef, smoke_CPUDetectionOutRefTest,
+        ::testing::Values(
+                // Caffe style, keep_top_k cuts the detections of both images
+                detectionout_ref_test_params{2, 3000, 5, true, false, 400, 100, 0.9f, 0.45f},
+                // Caffe style, everything passing NMS is kept
+                detectionout_ref_test_params{2, 3000, 5, true, false, -1, 3000, 0.95f, 0.45f},
+                // Caffe style, boxes decoded per class
+                detectionout_ref_test_params{2, 1000, 4, false, false, 200, 150, 0.8f, 0.5f},
+                // MXNet style, global top_k before NMS
+                detectionout_ref_test_params{2, 3000, 5, true, true, 400, 100, 0.9f, 0.45f},
+                // MXNet style, threshold keeps most priors
+                detectionout_ref_test_params{1, 1000, 3, true, true, -1, 1000, 0.1f, 0.3f}));
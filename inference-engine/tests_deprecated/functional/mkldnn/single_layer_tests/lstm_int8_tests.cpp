@@ -0,0 +1,301 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_system_conf.h>
+#include <exec_graph_info.hpp>
+#include <details/ie_cnn_network_iterator.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+#include "tests_common.hpp"
+#include "single_layer_common.hpp"
+
+#include <random>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+struct lstm_int8_test_params {
+    size_t N;   // Batch size
+    size_t D;   // Data size
+    size_t S;   // State size
+};
+
+class smoke_CPULSTMInt8Test: public TestsCommon,
+                             public WithParamInterface<lstm_int8_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Quantized_LSTM" version="6" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_D_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="input_low" type="Const" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="_O_IL_" size="4"/>
+            </blobs>
+        </layer>
+        <layer name="input_high" type="Const" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="_O_IH_" size="4"/>
+            </blobs>
+        </layer>
+        <layer name="output_low" type="Const" precision="FP32" id="3">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="_O_OL_" size="4"/>
+            </blobs>
+        </layer>
+        <layer name="output_high" type="Const" precision="FP32" id="4">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="_O_OH_" size="4"/>
+            </blobs>
+        </layer>
+        <layer name="quantize" type="FakeQuantize" precision="FP32" id="5">
+            <data levels="256"/>
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_D_</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5" precision="_QPREC_">
+                    <dim>_N_</dim>
+                    <dim>_D_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="h_state" type="Input" precision="FP32" id="6">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="c_state" type="Input" precision="FP32" id="7">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="lstm" type="LSTMCell" precision="FP32" id="8">
+            <data hidden_size="_S_"/>
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_D_</dim>
+                </port>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+                <port id="2">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+                <port id="4">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="_W_SIZE_"/>
+                <biases offset="_W_SIZE_" size="_B_SIZE_"/>
+            </blobs>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="5" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="5" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="5" to-port="2"/>
+        <edge from-layer="3" from-port="0" to-layer="5" to-port="3"/>
+        <edge from-layer="4" from-port="0" to-layer="5" to-port="4"/>
+        <edge from-layer="5" from-port="5" to-layer="8" to-port="0"/>
+        <edge from-layer="6" from-port="0" to-layer="8" to-port="1"/>
+        <edge from-layer="7" from-port="0" to-layer="8" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+protected:
+    const float inputLow = 0.f;
+    const float inputHigh = 2.f;
+    const size_t G = 4;
+
+    std::string getModel(const lstm_int8_test_params &p, const std::string &quantizePrecision) {
+        std::string model = model_t;
+        const size_t wSize = G * p.S * (p.D + p.S) * sizeof(float);
+        const size_t bSize = G * p.S * sizeof(float);
+
+        REPLACE_WITH_NUM(model, "_N_", p.N);
+        REPLACE_WITH_NUM(model, "_D_", p.D);
+        REPLACE_WITH_NUM(model, "_S_", p.S);
+        REPLACE_WITH_NUM(model, "_W_SIZE_", wSize);
+        REPLACE_WITH_NUM(model, "_B_SIZE_", bSize);
+        REPLACE_WITH_NUM(model, "_O_IL_", wSize + bSize);
+        REPLACE_WITH_NUM(model, "_O_IH_", wSize + bSize + 4);
+        REPLACE_WITH_NUM(model, "_O_OL_", wSize + bSize + 8);
+        REPLACE_WITH_NUM(model, "_O_OH_", wSize + bSize + 12);
+        REPLACE_WITH_STR(model, "_QPREC_", quantizePrecision);
+
+        return model;
+    }
+
+    // LSTM weights and biases followed by Quantize input_low, input_high, output_low and output_high
+    TBlob<uint8_t>::Ptr getWeights(const lstm_int8_test_params &p, float outputLow, float outputHigh) {
+        const size_t wCount = G * p.S * (p.D + p.S);
+        const size_t bCount = G * p.S;
+        TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>(
+                TensorDesc(Precision::U8, {(wCount + bCount + 4) * sizeof(float)}, Layout::C));
+        weights->allocate();
+
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+        float *ptr = weights->buffer().as<float *>();
+        for (size_t i = 0; i < wCount; i++)
+            ptr[i] = dist(gen);
+        for (size_t i = 0; i < bCount; i++)
+            ptr[wCount + i] = 0.1f * dist(gen);
+
+        ptr[wCount + bCount + 0] = inputLow;
+        ptr[wCount + bCount + 1] = inputHigh;
+        ptr[wCount + bCount + 2] = outputLow;
+        ptr[wCount + bCount + 3] = outputHigh;
+        return weights;
+    }
+
+    std::vector<Blob::Ptr> infer(const lstm_int8_test_params &p, const std::string &quantizePrecision,
+                                 float outputLow, float outputHigh, std::string &lstmPrimitiveType) {
+        Core ie;
+        CNNNetwork network = ie.ReadNetwork(getModel(p, quantizePrecision), getWeights(p, outputLow, outputHigh));
+        // Low precision transformations must not change the precision set in the IR
+        ExecutableNetwork exeNetwork = ie.LoadNetwork(network, "CPU",
+                {{PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE, PluginConfigParams::NO}});
+        InferRequest inferRequest = exeNetwork.CreateInferRequest();
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> data(inputLow, inputHigh);
+        std::uniform_real_distribution<float> state(-0.5f, 0.5f);
+        for (const auto &input : {std::make_pair("data", &data), std::make_pair("h_state", &state),
+                                  std::make_pair("c_state", &state)}) {
+            Blob::Ptr blob = inferRequest.GetBlob(input.first);
+            float *ptr = blob->buffer().as<float *>();
+            for (size_t i = 0; i < blob->size(); i++)
+                ptr[i] = (*input.second)(gen);
+        }
+
+        inferRequest.Infer();
+
+        CNNNetwork execGraph = exeNetwork.GetExecGraphInfo();
+        auto &inetwork = static_cast<const ICNNNetwork &>(execGraph);
+        details::CNNNetworkIterator i(&inetwork), end;
+        auto lstm = std::find_if(i, end, [](const CNNLayer::Ptr &layer) {
+            return layer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] == "lstm";
+        });
+        EXPECT_NE(lstm, end);
+        if (lstm != end)
+            lstmPrimitiveType = (*lstm)->params[ExecGraphInfoSerialization::IMPL_TYPE];
+
+        return {inferRequest.GetBlob("lstm.0"), inferRequest.GetBlob("lstm.1")};
+    }
+
+    static bool endsWith(const std::string &str, const std::string &suffix) {
+        return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+};
+
+// Quantize produces u8 values of the data, LSTM takes them with the data scale and shift of the Quantize.
+// FP32 counterpart quantizes and dequantizes the same data back, so both cells see the same values.
+TEST_P(smoke_CPULSTMInt8Test, MatchesFP32OnQuantizedInput) {
+    if (!with_cpu_x86_avx512_core())
+        GTEST_SKIP() << "int8 LSTM requires AVX-512 core";
+
+    lstm_int8_test_params p = GetParam();
+
+    std::string int8Type, fp32Type;
+    auto int8Outputs = infer(p, "U8", 0.f, 255.f, int8Type);
+    auto fp32Outputs = infer(p, "FP32", inputLow, inputHigh, fp32Type);
+
+    ASSERT_TRUE(endsWith(int8Type, "_I8")) << int8Type;
+    ASSERT_TRUE(endsWith(fp32Type, "_FP32")) << fp32Type;
+
+    // Only the weights get an additional quantization error
+    for (size_t o = 0; o < int8Outputs.size(); o++) {
+        const float *res = int8Outputs[o]->cbuffer().as<const float *>();
+        const float *ref = fp32Outputs[o]->cbuffer().as<const float *>();
+        for (size_t i = 0; i < int8Outputs[o]->size(); i++)
+            ASSERT_NEAR(ref[i], res[i], 0.03f) << "output " << o << ", element " << i;
+    }
+}
+
+// Rescaled Quantize output is not u8 = data * scale + shift anymore, LSTM has to stay in FP32
+TEST_P(smoke_CPULSTMInt8Test, RescaledQuantizeOutputKeepsFP32) {
+    lstm_int8_test_params p = GetParam();
+
+    std::string type;
+    infer(p, "U8", 0.f, 127.f, type);
+
+    ASSERT_FALSE(endsWith(type, "_I8")) << type;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsLSTMInt8, smoke_CPULSTMInt8Test,
+        ::testing::Values(
+                lstm_int8_test_params{1, 16, 16},
+                lstm_int8_test_params{2, 32, 16},
+                lstm_int8_test_params{4, 64, 32}));
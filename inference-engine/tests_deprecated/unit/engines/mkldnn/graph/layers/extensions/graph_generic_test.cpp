@@ -9,10 +9,86 @@
 #include <ie_plugin_config.hpp>
 #include "tests_common.hpp"
 
+#include <cstdlib>
+#include <new>
+
 using namespace ::testing;
 using namespace std;
 using namespace mkldnn;
 
+// Replaceable allocation functions of this binary forward to malloc like the default ones, and count the calls
+// only on a thread which has a HeapAllocationCounter alive, so other tests and threads are not affected.
+namespace {
+thread_local size_t* heapAllocationsCount = nullptr;
+
+void* countedAlloc(std::size_t size) noexcept {
+    if (heapAllocationsCount)
+        ++*heapAllocationsCount;
+    return std::malloc(size ? size : 1);
+}
+
+class HeapAllocationCounter {
+public:
+    HeapAllocationCounter() : previous(heapAllocationsCount) {
+        heapAllocationsCount = &allocations;
+    }
+    ~HeapAllocationCounter() {
+        heapAllocationsCount = previous;
+    }
+    size_t count() const {
+        return allocations;
+    }
+
+private:
+    size_t allocations = 0;
+    size_t* previous = nullptr;
+};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = countedAlloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = countedAlloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
 class FakeGenericPrimitiveImpl : public InferenceEngine::ILayerExecImpl {
 public:
     InferenceEngine::StatusCode getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig>& conf, InferenceEngine::ResponseDesc *resp) noexcept override {
@@ -177,6 +253,41 @@ private:
     InferenceEngine::CNNLayer * cnnLayer;
 };
 
+using BlobsRecord = std::vector<std::pair<InferenceEngine::Blob::Ptr, InferenceEngine::Blob::Ptr>>;
+
+// Keeps the blobs passed to every execute() call, so tests can check whether blobs are recreated
+class BlobsRecordingPrimitiveImpl : public DoublePrimitiveImpl {
+public:
+    BlobsRecordingPrimitiveImpl(const InferenceEngine::CNNLayer *layer, std::shared_ptr<BlobsRecord> record)
+            : DoublePrimitiveImpl(layer), record(record) {}
+
+    InferenceEngine::StatusCode execute(std::vector<InferenceEngine::Blob::Ptr>& inputs, std::vector<InferenceEngine::Blob::Ptr>& outputs, InferenceEngine::ResponseDesc *resp) noexcept override {
+        try {
+            record->emplace_back(inputs[0], outputs[0]);
+        } catch (...) {
+            return InferenceEngine::GENERAL_ERROR;
+        }
+        return DoublePrimitiveImpl::execute(inputs, outputs, resp);
+    }
+
+private:
+    std::shared_ptr<BlobsRecord> record;
+};
+
+class BlobsRecordingPrimitiveFactory : public InferenceEngine::ILayerImplFactory {
+public:
+    BlobsRecordingPrimitiveFactory(const InferenceEngine::CNNLayer *layer, std::shared_ptr<BlobsRecord> record)
+            : cnnLayer(layer), record(record) {}
+    InferenceEngine::StatusCode getImplementations(std::vector<InferenceEngine::ILayerImpl::Ptr>& impls, InferenceEngine::ResponseDesc *resp) noexcept override {
+        impls.push_back(InferenceEngine::ILayerImpl::Ptr(new BlobsRecordingPrimitiveImpl(cnnLayer, record)));
+        return InferenceEngine::OK;
+    }
+
+private:
+    const InferenceEngine::CNNLayer * cnnLayer;
+    std::shared_ptr<BlobsRecord> record;
+};
+
 class TwoDifferentOutputsImpl : public InferenceEngine::ILayerExecImpl {
 public:
     TwoDifferentOutputsImpl(const InferenceEngine::CNNLayer *layer) {
@@ -430,6 +541,10 @@ public:
         factories.clear();
     }
 
+    void addFactory(const std::string& type, fake_ext_factory factory) {
+        factories[type] = factory;
+    }
+
     void GetVersion(const InferenceEngine::Version *&versionInfo) const noexcept override {}
     void Unload() noexcept override {}
     void Release() noexcept override {
@@ -1522,3 +1637,144 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteInLineGRN) {
 
     compare(*output, *dstOut);
 }
+
+TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveReusesBlobs) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="1">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="BlobsRecordingLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    auto record = std::make_shared<BlobsRecord>();
+    auto fabric = new FakeExtensionFabric();
+    extension.reset(fabric);
+    fabric->addFactory("BlobsRecordingLayer", [record](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* {
+        return new BlobsRecordingPrimitiveFactory(cnnLayer, record);
+    });
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network, extMgr);
+
+    MKLDNNPlugin::MKLDNNNodePtr genericNode;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Generic)
+            genericNode = node;
+    }
+    ASSERT_NE(nullptr, genericNode);
+
+    mkldnn::stream strm(mkldnn::stream::kind::eager);
+    // Recorded blobs are kept alive, so a recreated wrapper can't get the address of the previous one
+    for (int i = 0; i < 4; i++) {
+        ASSERT_NO_THROW(genericNode->execute(strm));
+    }
+    ASSERT_EQ(4, record->size());
+    for (const auto &blobs : *record) {
+        EXPECT_EQ(record->front().first, blobs.first);
+        EXPECT_EQ(record->front().second, blobs.second);
+    }
+}
+
+TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithoutHeapAllocations) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="1">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="NewDoubleLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>1</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network, extMgr);
+
+    MKLDNNPlugin::MKLDNNNodePtr genericNode;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Generic)
+            genericNode = node;
+    }
+    ASSERT_NE(nullptr, genericNode);
+
+    mkldnn::stream strm(mkldnn::stream::kind::eager);
+    // The first run may prepare blob wrappers, steady state runs must not touch the heap
+    ASSERT_NO_THROW(genericNode->execute(strm));
+    size_t allocations = 0;
+    {
+        HeapAllocationCounter counter;
+        for (int i = 0; i < 4; i++)
+            genericNode->execute(strm);
+        allocations = counter.count();
+    }
+    ASSERT_EQ(0u, allocations);
+}
@@ -10,6 +10,7 @@
 
 #include <ie_core.hpp>
 #include <ie_plugin_config.hpp>
+#include <blob_factory.hpp>
 
 #include "single_layer_common.hpp"
 #include "tests_common.hpp"
@@ -140,6 +141,7 @@ static void ref_topk(InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<
 
 
 class MKLDNNCPUExtTopKTests : public TestsCommon, public WithParamInterface<topk_test_params> {
+protected:
     std::string model_t = R"V0G0N(
 <net Name="TopK_net" version="2" precision="FP32" batch="1">
     <layers>
@@ -337,7 +339,63 @@ INSTANTIATE_TEST_CASE_P(
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "max",{ 1, 18, 129, 129 },{},{} },
                 topk_test_params{ { 1, 20, 32, 32 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 32, 32 },{},{} },
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 129, 129 },{},{} },
-                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} }
+                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} },
+                // Selection on long innermost axis: heap, partial sort and axis split between threads
+                topk_test_params{ { 4, 1000 },{}, -1,{ 50 }, "value", "max",{ 4, 50 },{},{} },
+                topk_test_params{ { 4, 1000 },{}, -1,{ 50 }, "index", "min",{ 4, 50 },{},{} },
+                topk_test_params{ { 3, 256 },{}, 1,{ 200 }, "value", "min",{ 3, 200 },{},{} },
+                topk_test_params{ { 3, 256 },{}, 1,{ 200 }, "index", "max",{ 3, 200 },{},{} },
+                topk_test_params{ { 1, 250000 },{}, -1,{ 1 }, "value", "max",{ 1, 1 },{},{} },
+                topk_test_params{ { 1, 250000 },{}, -1,{ 20 }, "value", "min",{ 1, 20 },{},{} },
+                topk_test_params{ { 2, 1, 65536, 1 },{}, 2,{ 10 }, "index", "max",{ 2, 1, 10, 1 },{},{} }
+            ));
+
+// Runtime k which doesn't match the output shape, including zero and negative k, is rejected before selection
+class MKLDNNCPUExtTopKWrongKTests : public MKLDNNCPUExtTopKTests {
+protected:
+    void SetUp() override {
+        TestsCommon::SetUp();
+    }
+};
+
+TEST_P(MKLDNNCPUExtTopKWrongKTests, ThrowsOnWrongK) {
+    topk_test_params p = ::testing::WithParamInterface<topk_test_params>::GetParam();
+
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = ie.ReadNetwork(getModel(p), InferenceEngine::Blob::CPtr()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network);
+
+    InferenceEngine::BlobMap outputBlobs;
+    for (auto &item : network.getOutputsInfo()) {
+        auto output = make_blob_with_precision(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+    }
+
+    auto src = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.in_shape, InferenceEngine::TensorDesc::getLayoutByDims(p.in_shape) });
+    src->allocate();
+    fill_data_dbgval(src->buffer(), src->size());
+
+    auto k = InferenceEngine::make_shared_blob<int32_t>({ InferenceEngine::Precision::I32, { 1 }, InferenceEngine::Layout::C });
+    k->allocate();
+    k->data()[0] = static_cast<int32_t>(p.src_k[0]);
+
+    InferenceEngine::BlobMap srcs;
+    srcs["value"] = src;
+    srcs["src_k"] = k;
+    ASSERT_THROW(graph.Infer(srcs, outputBlobs), InferenceEngine::details::InferenceEngineException);
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsTopK, MKLDNNCPUExtTopKWrongKTests,
+            ::testing::Values(
+                topk_test_params{ { 2, 1000 },{}, -1,{ 0 }, "value", "max",{ 2, 50 },{},{} },
+                topk_test_params{ { 2, 1000 },{}, -1,{ static_cast<size_t>(-3) }, "value", "max",{ 2, 50 },{},{} },
+                topk_test_params{ { 2, 1000 },{}, -1,{ 20 }, "value", "max",{ 2, 50 },{},{} },
+                topk_test_params{ { 2, 16, 8 },{}, 1,{ 0 }, "index", "min",{ 2, 4, 8 },{},{} }
             ));
 
 
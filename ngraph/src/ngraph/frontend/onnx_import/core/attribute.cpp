@@ -46,7 +46,7 @@ namespace ngraph
             // be a problem, since we add ONNX opset as a default available opset. Moreover
             // if we encounter a node absent in current available opsets we will try
             // to add it's domain to available opsets.
-            Model model{model_proto};
+            Model model{model_proto, parent_graph.get_model_dir()};
             return Subgraph{graph, model, parent_graph};
         }
 
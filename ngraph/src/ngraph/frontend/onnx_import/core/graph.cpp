@@ -82,7 +82,7 @@ namespace ngraph
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, m_model->get_model_dir()};
                     initializers.emplace(initializer_tensor.name(), tensor);
 
                     // For each initializer create a Constant node and store it in cache
@@ -46,6 +46,7 @@ namespace ngraph
             const std::string& get_name() const { return m_graph_proto->name(); }
             NodeVector make_ng_nodes(const Node& onnx_node) const;
             const GraphCache& get_graph_cache() const;
+            const std::string& get_model_dir() const { return m_model->get_model_dir(); }
 
         protected:
             Graph(const ONNX_NAMESPACE::GraphProto& proto,
@@ -31,7 +31,11 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \param[in]  model_proto  The ONNX model.
+            /// \param[in]  model_dir    The directory of the model file, used to find
+            ///                          tensor data stored in external files.
+            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                           const std::string& model_dir = "");
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -42,6 +46,7 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            const std::string& get_model_dir() const { return m_model_dir; }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -75,6 +80,7 @@ namespace ngraph
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
+            std::string m_model_dir;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Model& model)
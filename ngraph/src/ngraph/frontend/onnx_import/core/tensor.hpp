@@ -17,12 +17,14 @@
 #pragma once
 
 #include <onnx/onnx_pb.h>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -389,9 +391,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param[in]  tensor     The ONNX tensor.
+            /// \param[in]  model_dir  The directory of the model file, external data of
+            ///                        the tensor is searched relative to it.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            const std::string& model_dir = "")
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_model_dir{model_dir}
             {
                 if (m_shape == Shape{0})
                 {
@@ -416,6 +423,12 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    const auto buffer = load_external_data();
+                    const auto data = buffer->get_ptr<T>();
+                    return std::vector<T>(data, data + buffer->size() / sizeof(T));
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -509,11 +522,46 @@ namespace ngraph
             }
 
         private:
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation::
+                               TensorProto_DataLocation_EXTERNAL;
+            }
+
+            std::shared_ptr<runtime::AlignedBuffer> load_external_data() const
+            {
+                return detail::TensorExternalData{*m_tensor_proto}.load_external_data(
+                    m_model_dir);
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (has_external_data())
+                {
+                    // External data is mapped to memory and used by the constant as is
+                    constant =
+                        std::make_shared<ngraph::op::Constant>(type, m_shape, load_external_data());
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == shape_size(m_shape) * sizeof(T))
+                {
+                    // Copy raw data to the constant at once, without an intermediate vector
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -523,6 +571,7 @@ namespace ngraph
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::string m_model_dir;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
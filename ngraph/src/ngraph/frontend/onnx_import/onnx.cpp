@@ -52,7 +52,8 @@ namespace ngraph
             } // namespace error
         }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path)
         {
             ONNX_NAMESPACE::ModelProto model_proto;
             // Try parsing input as a binary protobuf message
@@ -69,7 +70,10 @@ namespace ngraph
                 }
             }
 
-            Model model{model_proto};
+            // External data locations are relative to the directory of the model file
+            const auto separator = model_path.find_last_of("/\\");
+            Model model{model_proto,
+                        separator != std::string::npos ? model_path.substr(0, separator) : ""};
             Graph graph{model_proto.graph(), model};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
@@ -87,7 +91,7 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            return import_onnx_model(ifs, file_path);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
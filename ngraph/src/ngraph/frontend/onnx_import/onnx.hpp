@@ -62,17 +62,21 @@ namespace ngraph
         /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
         ///             the function throws an ngraph_error exception.
         ///
-        /// \param[in]  stream    The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  stream      The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  model_path  The path to the model file the stream is read from. Tensor
+        ///                         data stored in external files is searched relative to it.
         ///
         /// \return     An nGraph function that represents a single output from the created graph.
         ONNX_IMPORTER_API
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream);
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path = "");
 
         /// \brief     Imports and converts an ONNX model from the input file
         ///            to an nGraph Function representation.
         ///
         /// \note      If file parsing fails or the ONNX model contains unsupported ops,
         ///            the function throws an ngraph_error exception.
+        ///            Tensor data stored in external files is memory mapped where possible.
         ///
         /// \param[in] file_path  The path to a file containing the ONNX model
         ///                       (relative or absolute).
@@ -0,0 +1,230 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "utils/tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& message)
+                        : ngraph_error{"invalid external data: " + message}
+                    {
+                    }
+                };
+            }
+        }
+
+        namespace detail
+        {
+            namespace
+            {
+                // Alignment of data in AlignedBuffer by default
+                constexpr uint64_t data_alignment = 64;
+
+                bool is_absolute_path(const std::string& path)
+                {
+                    return !path.empty() &&
+                           (path[0] == '/' || path[0] == '\\' ||
+                            (path.size() > 1 && path[1] == ':'));
+                }
+
+                bool has_parent_dir_component(const std::string& path)
+                {
+                    size_t start = 0;
+                    while (true)
+                    {
+                        const auto end = path.find_first_of("/\\", start);
+                        if (path.compare(start, end - start, "..") == 0)
+                        {
+                            return true;
+                        }
+                        if (end == std::string::npos)
+                        {
+                            return false;
+                        }
+                        start = end + 1;
+                    }
+                }
+            }
+
+            TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    try
+                    {
+                        if (entry.key() == "location")
+                        {
+                            m_data_location = entry.value();
+                        }
+                        else if (entry.key() == "offset")
+                        {
+                            m_offset = std::stoull(entry.value());
+                        }
+                        else if (entry.key() == "length")
+                        {
+                            m_data_length = std::stoull(entry.value());
+                        }
+                        // "checksum" is optional and isn't verified
+                    }
+                    catch (const std::logic_error&)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "wrong value of " + entry.key() + ": " + entry.value()};
+                    }
+                }
+                if (m_data_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{"location of tensor " +
+                                                               tensor.name() + " is not set"};
+                }
+                // Models may come from untrusted sources, they must not reach files outside of
+                // their directory
+                if (is_absolute_path(m_data_location) || has_parent_dir_component(m_data_location))
+                {
+                    throw error::tensor::invalid_external_data{
+                        "location of tensor " + tensor.name() +
+                        " must be a relative path inside of the model directory: " +
+                        m_data_location};
+                }
+            }
+
+#ifndef _WIN32
+            std::shared_ptr<runtime::AlignedBuffer>
+                TensorExternalData::load_external_data(const std::string& model_dir) const
+            {
+                const auto path = file_util::path_join(model_dir, m_data_location);
+                const int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    throw error::tensor::invalid_external_data{"failed to open " + path};
+                }
+
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) != 0 ||
+                    m_offset > static_cast<uint64_t>(file_stat.st_size) ||
+                    m_data_length > static_cast<uint64_t>(file_stat.st_size) - m_offset)
+                {
+                    close(fd);
+                    throw error::tensor::invalid_external_data{"data is out of bounds of " + path};
+                }
+                const size_t length = m_data_length != 0
+                                          ? m_data_length
+                                          : static_cast<size_t>(file_stat.st_size - m_offset);
+                if (length == 0)
+                {
+                    close(fd);
+                    return std::make_shared<runtime::AlignedBuffer>();
+                }
+
+                // Constant data is accessed as an array of its element type, so data which
+                // isn't aligned in the file is read into an aligned buffer instead of mapping
+                if (m_offset % data_alignment != 0)
+                {
+                    auto buffer = std::make_shared<runtime::AlignedBuffer>(length);
+                    size_t done = 0;
+                    while (done < length)
+                    {
+                        const ssize_t count = pread(fd,
+                                                    buffer->get_ptr<char>() + done,
+                                                    length - done,
+                                                    static_cast<off_t>(m_offset + done));
+                        if (count <= 0)
+                        {
+                            close(fd);
+                            throw error::tensor::invalid_external_data{"failed to read " + path};
+                        }
+                        done += static_cast<size_t>(count);
+                    }
+                    close(fd);
+                    return buffer;
+                }
+
+                // Offset of mapping must be a multiple of page size
+                const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                const uint64_t map_offset = m_offset - m_offset % page_size;
+                const size_t map_size = length + static_cast<size_t>(m_offset - map_offset);
+                // Private mapping lets the constant be modified in place without touching the file
+                void* addr = mmap(nullptr,
+                                  map_size,
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE,
+                                  fd,
+                                  static_cast<off_t>(map_offset));
+                close(fd);
+                if (addr == MAP_FAILED)
+                {
+                    throw error::tensor::invalid_external_data{"failed to map " + path};
+                }
+
+                std::shared_ptr<void> mapping(addr, [map_size](void* p) { munmap(p, map_size); });
+                return std::make_shared<runtime::SharedBuffer<std::shared_ptr<void>>>(
+                    static_cast<char*>(addr) + (m_offset - map_offset), length, mapping);
+            }
+#else
+            std::shared_ptr<runtime::AlignedBuffer>
+                TensorExternalData::load_external_data(const std::string& model_dir) const
+            {
+                const auto path = file_util::path_join(model_dir, m_data_location);
+                std::ifstream file{path, std::ios::in | std::ios::binary | std::ios::ate};
+                if (!file.is_open())
+                {
+                    throw error::tensor::invalid_external_data{"failed to open " + path};
+                }
+
+                const uint64_t file_size = static_cast<uint64_t>(file.tellg());
+                if (m_offset > file_size || m_data_length > file_size - m_offset)
+                {
+                    throw error::tensor::invalid_external_data{"data is out of bounds of " + path};
+                }
+                const size_t length = m_data_length != 0 ? m_data_length : file_size - m_offset;
+                if (length == 0)
+                {
+                    return std::make_shared<runtime::AlignedBuffer>();
+                }
+
+                auto buffer = std::make_shared<runtime::AlignedBuffer>(length);
+                file.seekg(m_offset, std::ios::beg);
+                file.read(buffer->get_ptr<char>(), length);
+                if (!file)
+                {
+                    throw error::tensor::invalid_external_data{"failed to read " + path};
+                }
+                return buffer;
+            }
+#endif
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
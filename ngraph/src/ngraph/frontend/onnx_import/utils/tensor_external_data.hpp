@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            /// \brief  Describes tensor data stored outside of the model file
+            ///         (data_location = EXTERNAL) and loads it.
+            class TensorExternalData
+            {
+            public:
+                /// \throw     invalid_external_data if the location is not a relative path
+                ///            inside of the model directory.
+                explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+                /// \brief      Loads the data, memory mapping the file where it's possible,
+                ///             so the data isn't copied until it's modified. Data which is
+                ///             not aligned in the file as AlignedBuffer aligns it is copied.
+                ///
+                /// \param[in]  model_dir  The directory of the model file. Data location is
+                ///                        relative to it.
+                ///
+                /// \return     The buffer with tensor data.
+                std::shared_ptr<runtime::AlignedBuffer>
+                    load_external_data(const std::string& model_dir) const;
+
+            private:
+                std::string m_data_location{};
+                uint64_t m_offset = 0;
+                uint64_t m_data_length = 0;
+            };
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
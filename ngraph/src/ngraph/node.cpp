@@ -1118,7 +1118,13 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     {
         if (auto constant = as_type_ptr<op::v0::Constant>(input.get_node_shared_ptr()))
         {
-            auto host_tensor = make_shared<runtime::HostTensor>(constant);
+            // evaluate() only reads inputs, so the tensor refers to the constant's data
+            // instead of copying it
+            auto host_tensor =
+                make_shared<HostTensor>(constant->get_output_element_type(0),
+                                        constant->get_output_shape(0),
+                                        const_cast<void*>(constant->get_data_ptr()),
+                                        constant->output(0).get_tensor().get_name());
             input_tensors.push_back(host_tensor);
         }
         else
@@ -1127,18 +1133,41 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
         }
     }
     HostTensorVector output_tensors;
-    OutputVector output_constants;
+    // Outputs of a known size are computed right in the buffers of the resulting constants
+    vector<shared_ptr<runtime::AlignedBuffer>> output_buffers(get_output_size());
     for (auto output : outputs())
     {
-        auto tensor =
-            make_shared<HostTensor>(output.get_element_type(), output.get_partial_shape());
+        const auto& element_type = output.get_element_type();
+        const auto& partial_shape = output.get_partial_shape();
+        shared_ptr<HostTensor> tensor;
+        if (partial_shape.is_static() && element_type.is_static() &&
+            element_type.bitwidth() % 8 == 0)
+        {
+            const auto& shape = partial_shape.to_shape();
+            auto& buffer = output_buffers[output.get_index()];
+            buffer = make_shared<runtime::AlignedBuffer>(shape_size(shape) * element_type.size());
+            tensor = make_shared<HostTensor>(element_type, shape, buffer->get_ptr());
+        }
+        else
+        {
+            tensor = make_shared<HostTensor>(element_type, partial_shape);
+        }
         output_tensors.push_back(tensor);
     }
     if (evaluate(output_tensors, input_tensors))
     {
         for (size_t i = 0; i < output_tensors.size(); ++i)
         {
-            output_values[i] = make_shared<op::Constant>(output_tensors[i]);
+            if (output_buffers[i])
+            {
+                output_values[i] = make_shared<op::Constant>(output_tensors[i]->get_element_type(),
+                                                             output_tensors[i]->get_shape(),
+                                                             output_buffers[i]);
+            }
+            else
+            {
+                output_values[i] = make_shared<op::Constant>(output_tensors[i]);
+            }
         }
         return true;
     }
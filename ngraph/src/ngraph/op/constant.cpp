@@ -316,6 +316,29 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const std::shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NODE_VALIDATION_CHECK(this,
+                          m_data && m_data->size() == size,
+                          "Buffer size doesn't match the constant of shape ",
+                          m_shape,
+                          " and type ",
+                          m_element_type,
+                          " (expected ",
+                          size,
+                          " bytes, got ",
+                          (m_data ? m_data->size() : 0),
+                          ").");
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
     : Constant(other.m_element_type, other.m_shape)
 {
@@ -324,6 +347,21 @@ op::Constant::Constant(const Constant& other)
     constructor_validate_and_infer_types();
 }
 
+op::Constant::Constant(const Constant& other, const Shape& new_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(new_shape)
+    , m_data(other.m_data)
+    , m_all_elements_bitwise_identical(other.m_all_elements_bitwise_identical)
+{
+    NODE_VALIDATION_CHECK(this,
+                          shape_size(m_shape) == shape_size(other.m_shape),
+                          "Shape ",
+                          m_shape,
+                          " doesn't match the number of elements of the constant of shape ",
+                          other.m_shape);
+    constructor_validate_and_infer_types();
+}
+
 op::Constant::~Constant()
 {
 }
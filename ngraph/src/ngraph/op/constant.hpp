@@ -233,7 +233,25 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant which uses the supplied buffer without
+                ///        copying it, e.g. memory mapped from a file.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer with constant data. Its size must match the type and shape.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
+
+                /// \brief Constructs a tensor constant of another shape which shares the data
+                ///        of an existing constant, e.g. when folding a reshape.
+                ///
+                /// \param other The constant whose data is used.
+                /// \param new_shape The shape of the new constant. It must have the same number
+                ///                  of elements as the shape of other.
+                Constant(const Constant& other, const Shape& new_shape);
                 Constant& operator=(const Constant&) = delete;
 
                 virtual ~Constant() override;
@@ -17,7 +17,7 @@
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
-#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/opt_kernel/gather.hpp"
 #include "ngraph/shape.hpp"
 
 #include <limits>
@@ -241,23 +241,23 @@ namespace
 
         if (arg1->get_element_type() == element::i64)
         {
-            runtime::reference::gather<T, int64_t>(arg0->get_data_ptr<ET>(),
-                                                   arg1->get_data_ptr<int64_t>(),
-                                                   out->get_data_ptr<ET>(),
-                                                   arg0->get_shape(),
-                                                   arg1->get_shape(),
-                                                   out->get_shape(),
-                                                   axis);
+            runtime::opt_kernel::gather<T, int64_t>(arg0->get_data_ptr<ET>(),
+                                                    arg1->get_data_ptr<int64_t>(),
+                                                    out->get_data_ptr<ET>(),
+                                                    arg0->get_shape(),
+                                                    arg1->get_shape(),
+                                                    out->get_shape(),
+                                                    axis);
         }
         else if (arg1->get_element_type() == element::i32)
         {
-            runtime::reference::gather<T, int32_t>(arg0->get_data_ptr<ET>(),
-                                                   arg1->get_data_ptr<int32_t>(),
-                                                   out->get_data_ptr<ET>(),
-                                                   arg0->get_shape(),
-                                                   arg1->get_shape(),
-                                                   out->get_shape(),
-                                                   axis);
+            runtime::opt_kernel::gather<T, int32_t>(arg0->get_data_ptr<ET>(),
+                                                    arg1->get_data_ptr<int32_t>(),
+                                                    out->get_data_ptr<ET>(),
+                                                    arg0->get_shape(),
+                                                    arg1->get_shape(),
+                                                    out->get_shape(),
+                                                    axis);
         }
         else
         {
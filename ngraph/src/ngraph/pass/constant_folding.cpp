@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include "constant_folding.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -32,6 +34,29 @@ bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
     return true;
 }
 
+// Returns the only consumer of the single output of the node if it's an elementwise arithmetic
+// op. Such ops have no dedicated folding handlers, so folding them right after the node
+// doesn't bypass any of the handlers.
+static shared_ptr<Node> get_elementwise_consumer(const shared_ptr<Node>& node)
+{
+    if (node->get_output_size() != 1)
+    {
+        return nullptr;
+    }
+    const auto targets = node->output(0).get_target_inputs();
+    if (targets.size() != 1)
+    {
+        return nullptr;
+    }
+    auto consumer = targets.begin()->get_node()->shared_from_this();
+    if (!dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(consumer) &&
+        !dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(consumer))
+    {
+        return nullptr;
+    }
+    return consumer;
+}
+
 void ngraph::pass::ConstantFolding::construct_constant_default()
 {
     add_handler("Constant folding defaults",
@@ -45,10 +70,35 @@ void ngraph::pass::ConstantFolding::construct_constant_default()
                         replacements.size() == node->get_output_size(),
                         "constant_fold_default returned incorrect number of replacements for ",
                         node);
+
+                    // Chains of elementwise ops (e.g. dequantization of weights) are folded at
+                    // once: constants of intermediate results are not inserted into the graph
+                    // and are released as soon as the next op is evaluated.
+                    auto folded = node;
+                    while (auto consumer = get_elementwise_consumer(folded))
+                    {
+                        auto consumer_inputs = consumer->input_values();
+                        for (auto& input : consumer_inputs)
+                        {
+                            if (input.get_node_shared_ptr() == folded)
+                            {
+                                input = replacements.at(0);
+                            }
+                        }
+                        OutputVector consumer_replacements(consumer->get_output_size());
+                        if (!consumer->constant_fold(consumer_replacements, consumer_inputs) ||
+                            !consumer_replacements.at(0).get_node_shared_ptr())
+                        {
+                            break;
+                        }
+                        folded = consumer;
+                        replacements = consumer_replacements;
+                    }
+
                     bool result{false};
                     for (size_t i = 0; i < replacements.size(); ++i)
                     {
-                        auto node_output = node->output(i);
+                        auto node_output = folded->output(i);
                         auto replacement = replacements.at(i);
                         if (replacement.get_node_shared_ptr() && (node_output != replacement))
                         {
@@ -38,8 +38,8 @@ static shared_ptr<op::Constant>
                                               shared_ptr<Node> reduction_node)
 {
     const Shape& out_shape = reduction_node->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     if (auto max = as_type_ptr<op::Max>(reduction_node))
     {
@@ -113,7 +113,7 @@ static shared_ptr<op::Constant>
     }
 
     return make_shared<op::Constant>(
-        reduction_node->get_output_element_type(0), reduction_node->get_shape(), data_ptr);
+        reduction_node->get_output_element_type(0), reduction_node->get_shape(), buffer);
 }
 
 static shared_ptr<op::Constant>
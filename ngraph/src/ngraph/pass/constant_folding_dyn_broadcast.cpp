@@ -16,7 +16,7 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/experimental/dyn_broadcast.hpp"
-#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/opt_kernel/broadcast.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace std;
@@ -28,13 +28,13 @@ shared_ptr<op::Constant> fold_constant_dyn_broadcast(shared_ptr<op::Constant> ar
                                                      shared_ptr<op::Constant> axes)
 {
     const Shape& out_shape = shape->get_shape_val();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
-    runtime::reference::broadcast<T>(
+    runtime::opt_kernel::broadcast<T>(
         arg->get_data_ptr<T>(), data_ptr, arg->get_shape(), out_shape, axes->get_axis_set_val());
 
-    return make_shared<op::Constant>(arg->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(arg->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_dyn_broadcast()
@@ -28,10 +28,8 @@ template <typename T, typename R>
 shared_ptr<op::Constant> fold_constant_dyn_reshape(shared_ptr<op::Constant> constant_data,
                                                    R dyn_reshape)
 {
-    // v1::Reshape and v0::DynReshape do not allow data transposes.
-    return make_shared<op::Constant>(dyn_reshape->get_element_type(),
-                                     dyn_reshape->get_shape(),
-                                     constant_data->get_data_ptr<T>());
+    // v1::Reshape and v0::DynReshape do not allow data transposes, so the data is shared.
+    return make_shared<op::Constant>(*constant_data, dyn_reshape->get_shape());
 }
 
 template <typename R>
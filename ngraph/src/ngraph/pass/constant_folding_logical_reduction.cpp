@@ -43,8 +43,9 @@ static Shape get_shape_no_keep_dims(const AxisSet& reduction_axes, const Shape&
 static shared_ptr<op::Constant> fold_constant_logical_reduction(shared_ptr<op::Constant> constant,
                                                                 shared_ptr<Node> reduction_node)
 {
-    runtime::AlignedBuffer buffer(shape_size(reduction_node->get_shape()) * sizeof(char));
-    char* data_ptr = buffer.get_ptr<char>();
+    auto buffer =
+        make_shared<runtime::AlignedBuffer>(shape_size(reduction_node->get_shape()) * sizeof(char));
+    char* data_ptr = buffer->get_ptr<char>();
 
     if (auto all = as_type_ptr<::ngraph::op::All>(reduction_node))
     {
@@ -93,7 +94,7 @@ static shared_ptr<op::Constant> fold_constant_logical_reduction(shared_ptr<op::C
     }
 
     return make_shared<op::Constant>(
-        reduction_node->get_output_element_type(0), reduction_node->get_shape(), data_ptr);
+        reduction_node->get_output_element_type(0), reduction_node->get_shape(), buffer);
 }
 
 void pass::ConstantFolding::construct_constant_logical_reduction()
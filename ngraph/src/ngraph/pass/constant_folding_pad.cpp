@@ -27,8 +27,8 @@ shared_ptr<op::Constant> fold_constant_pad(shared_ptr<op::Constant> constant,
                                            NodeExecutorTy func)
 {
     const Shape& out_shape = pad->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
     auto pad_value = std::static_pointer_cast<op::Constant>(pad->get_input_node_shared_ptr(1));
 
     if (func != nullptr)
@@ -54,7 +54,7 @@ shared_ptr<op::Constant> fold_constant_pad(shared_ptr<op::Constant> constant,
                                    pad->get_pad_mode());
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_pad()
@@ -26,13 +26,13 @@ static shared_ptr<op::Constant> fold_constant_reverse_helper(shared_ptr<op::Cons
                                                              const AxisSet& reversed_axes)
 {
     const Shape& out_shape = constant->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     runtime::reference::reverse<T>(
         constant->get_data_ptr<T>(), data_ptr, out_shape, out_shape, reversed_axes);
 
-    return make_shared<op::Constant>(constant->get_output_element_type(0), out_shape, data_ptr);
+    return make_shared<op::Constant>(constant->get_output_element_type(0), out_shape, buffer);
 }
 
 static shared_ptr<op::Constant> fold_constant_reverse(shared_ptr<op::Constant> constant,
@@ -30,8 +30,9 @@ static shared_ptr<op::Constant>
                                     const shared_ptr<op::Constant>& axis,
                                     const shared_ptr<Node>& scatter)
 {
-    runtime::AlignedBuffer buffer(shape_size(scatter->get_shape()) * sizeof(DataType));
-    DataType* data_ptr = buffer.get_ptr<DataType>();
+    auto buffer =
+        make_shared<runtime::AlignedBuffer>(shape_size(scatter->get_shape()) * sizeof(DataType));
+    DataType* data_ptr = buffer->get_ptr<DataType>();
 
     if (is_type<op::v3::ScatterElementsUpdate>(scatter))
     {
@@ -54,7 +55,7 @@ static shared_ptr<op::Constant>
     }
 
     return make_shared<op::Constant>(
-        scatter->get_output_element_type(0), scatter->get_output_shape(0), data_ptr);
+        scatter->get_output_element_type(0), scatter->get_output_shape(0), buffer);
 }
 
 template <typename T, typename U>
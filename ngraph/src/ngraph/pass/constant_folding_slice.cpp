@@ -16,7 +16,7 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/slice.hpp"
-#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/opt_kernel/slice.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -26,18 +26,18 @@ shared_ptr<op::Constant> fold_constant_slice(shared_ptr<op::Constant> constant,
                                              shared_ptr<op::Slice> slice)
 {
     const Shape& out_shape = slice->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
-    runtime::reference::slice<T>(constant->get_data_ptr<T>(),
-                                 data_ptr,
-                                 constant->get_shape(),
-                                 slice->get_lower_bounds(),
-                                 slice->get_upper_bounds(),
-                                 slice->get_strides(),
-                                 out_shape);
+    runtime::opt_kernel::slice<T>(constant->get_data_ptr<T>(),
+                                  data_ptr,
+                                  constant->get_shape(),
+                                  slice->get_lower_bounds(),
+                                  slice->get_upper_bounds(),
+                                  slice->get_strides(),
+                                  out_shape);
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_slice()
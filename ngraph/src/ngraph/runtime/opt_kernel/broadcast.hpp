@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
-#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/axis_set.hpp"
+#include "ngraph/check.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/util.hpp"
 
@@ -170,6 +173,89 @@ namespace ngraph
                 }
             }
 
+            /// \brief Broadcast of an arbitrary rank. Every output axis gets an input stride,
+            ///        which is zero for the broadcast axes, so the output is filled row by row.
+            template <typename T>
+            void broadcast_nd(const T* in,
+                              T* out,
+                              const Shape& in_shape,
+                              const Shape& out_shape,
+                              const AxisSet& broadcast_axes)
+            {
+                const size_t rank = out_shape.size();
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+                if (rank == 0)
+                {
+                    *out = *in;
+                    return;
+                }
+
+                // Same mapping as in reference::broadcast: input axes of length 1 are dropped,
+                // the rest go to the output axes which are neither broadcast nor of length 1.
+                Shape adjusted_in_shape;
+                for (auto length : in_shape)
+                {
+                    if (length != 1)
+                    {
+                        adjusted_in_shape.push_back(length);
+                    }
+                }
+                const auto adjusted_in_strides = row_major_strides(adjusted_in_shape);
+                std::vector<size_t> in_strides(rank, 0);
+                size_t in_axis = 0;
+                for (size_t axis = 0; axis < rank; axis++)
+                {
+                    if (broadcast_axes.count(axis) == 0 && out_shape[axis] != 1)
+                    {
+                        NGRAPH_CHECK(in_axis < adjusted_in_shape.size() &&
+                                     adjusted_in_shape[in_axis] == out_shape[axis]);
+                        in_strides[axis] = adjusted_in_strides[in_axis++];
+                    }
+                }
+                NGRAPH_CHECK(in_axis == adjusted_in_shape.size());
+
+                const size_t row = out_shape[rank - 1];
+                const size_t row_stride = in_strides[rank - 1];
+                std::vector<size_t> counter(rank - 1, 0);
+                while (true)
+                {
+                    if (row_stride == 0)
+                    {
+                        out = std::fill_n(out, row, *in);
+                    }
+                    else if (row_stride == 1)
+                    {
+                        out = std::copy(in, in + row, out);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < row; i++)
+                        {
+                            *out++ = in[i * row_stride];
+                        }
+                    }
+
+                    size_t axis = rank - 1;
+                    for (; axis > 0; axis--)
+                    {
+                        in += in_strides[axis - 1];
+                        if (++counter[axis - 1] < out_shape[axis - 1])
+                        {
+                            break;
+                        }
+                        in -= in_strides[axis - 1] * out_shape[axis - 1];
+                        counter[axis - 1] = 0;
+                    }
+                    if (axis == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
             template <typename T>
             void broadcast(const T* in,
                            T* out,
@@ -177,7 +263,7 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                if (in_shape.size() == 0)
+                if (shape_size(in_shape) == 1)
                 {
                     for (size_t i = 0; i < shape_size(out_shape); ++i)
                     {
@@ -203,14 +289,13 @@ namespace ngraph
                     case 5: broadcast_5d<T>(in, out, in_shape, out_shape, output_axis); break;
                     case 6: broadcast_6d<T>(in, out, in_shape, out_shape, output_axis); break;
                     default:
-                        runtime::reference::broadcast<T>(
-                            in, out, in_shape, out_shape, broadcast_axes);
+                        broadcast_nd<T>(in, out, in_shape, out_shape, broadcast_axes);
                         break;
                     }
                 }
                 else
                 {
-                    runtime::reference::broadcast<T>(in, out, in_shape, out_shape, broadcast_axes);
+                    broadcast_nd<T>(in, out, in_shape, out_shape, broadcast_axes);
                 }
             }
         }
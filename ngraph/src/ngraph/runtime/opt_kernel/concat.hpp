@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Same as reference::concat, but copies every input as a sequence of
+            ///        contiguous blocks: a block is all elements of the input following one
+            ///        index of the axes before the concatenation axis.
+            template <typename T>
+            void concat(const std::vector<const T*>& args,
+                        T* out,
+                        const std::vector<Shape>& in_shapes,
+                        const Shape& out_shape,
+                        int64_t concatenation_axis)
+            {
+                NGRAPH_CHECK(args.size() == in_shapes.size());
+                const size_t axis = static_cast<size_t>(concatenation_axis);
+
+                size_t outer = 1;
+                for (size_t i = 0; i < axis; i++)
+                {
+                    outer *= out_shape[i];
+                }
+                size_t out_block = 1;
+                for (size_t i = axis; i < out_shape.size(); i++)
+                {
+                    out_block *= out_shape[i];
+                }
+
+                size_t out_offset = 0;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    size_t in_block = 1;
+                    for (size_t j = axis; j < in_shapes[i].size(); j++)
+                    {
+                        in_block *= in_shapes[i][j];
+                    }
+                    NGRAPH_CHECK(out_offset + in_block <= out_block);
+
+                    const T* in = args[i];
+                    for (size_t o = 0; o < outer; o++, in += in_block)
+                    {
+                        std::copy(in, in + in_block, out + o * out_block + out_offset);
+                    }
+                    out_offset += in_block;
+                }
+            }
+        }
+    }
+}
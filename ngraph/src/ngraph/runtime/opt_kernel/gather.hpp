@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Same as reference::gather, but copies a contiguous block of elements
+            ///        following the gather axis for every index instead of going through
+            ///        gather_nd sub-problems.
+            template <typename T, typename U>
+            void gather(const T* params,
+                        const U* indices,
+                        T* out,
+                        const Shape& params_shape,
+                        const Shape& indices_shape,
+                        const Shape& out_shape,
+                        size_t axis)
+            {
+                NGRAPH_CHECK(axis < params_shape.size());
+                NGRAPH_CHECK(out_shape.size() == params_shape.size() + indices_shape.size() - 1);
+
+                size_t outer = 1;
+                for (size_t i = 0; i < axis; i++)
+                {
+                    outer *= params_shape[i];
+                }
+                size_t inner = 1;
+                for (size_t i = axis + 1; i < params_shape.size(); i++)
+                {
+                    inner *= params_shape[i];
+                }
+                const int64_t axis_size = static_cast<int64_t>(params_shape[axis]);
+                const size_t indices_count = shape_size(indices_shape);
+
+                for (size_t o = 0; o < outer; o++)
+                {
+                    const T* params_outer = params + o * axis_size * inner;
+                    for (size_t i = 0; i < indices_count; i++)
+                    {
+                        int64_t index = static_cast<int64_t>(indices[i]);
+                        index = index >= 0 ? index : index + axis_size;
+                        NGRAPH_CHECK(index >= 0 && index < axis_size,
+                                     "Gather index ",
+                                     indices[i],
+                                     " is out of range [0, ",
+                                     axis_size,
+                                     ")");
+                        const T* block = params_outer + index * inner;
+                        out = std::copy(block, block + inner, out);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Same as reference::slice, but walks the input with precomputed strides
+            ///        instead of CoordinateTransform. Rows with unit stride are block copied.
+            template <typename T>
+            void slice(const T* arg,
+                       T* out,
+                       const Shape& arg_shape,
+                       const Coordinate& lower_bounds,
+                       const Coordinate& upper_bounds,
+                       const Strides& strides,
+                       const Shape& out_shape)
+            {
+                const size_t rank = arg_shape.size();
+                NGRAPH_CHECK(lower_bounds.size() == rank && upper_bounds.size() == rank &&
+                             strides.size() == rank && out_shape.size() == rank);
+
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+                if (rank == 0)
+                {
+                    *out = *arg;
+                    return;
+                }
+
+                const auto in_strides = row_major_strides(arg_shape);
+                std::vector<size_t> steps(rank);
+                const T* in = arg;
+                for (size_t i = 0; i < rank; i++)
+                {
+                    NGRAPH_CHECK(upper_bounds[i] <= arg_shape[i]);
+                    in += lower_bounds[i] * in_strides[i];
+                    steps[i] = strides[i] * in_strides[i];
+                }
+
+                const size_t row = out_shape[rank - 1];
+                const size_t row_step = steps[rank - 1];
+                Coordinate counter(rank - 1, 0);
+                while (true)
+                {
+                    if (row_step == 1)
+                    {
+                        out = std::copy(in, in + row, out);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < row; i++)
+                        {
+                            *out++ = in[i * row_step];
+                        }
+                    }
+
+                    // advance to the next row, carrying over outer axes
+                    size_t axis = rank - 1;
+                    for (; axis > 0; axis--)
+                    {
+                        in += steps[axis - 1];
+                        if (++counter[axis - 1] < out_shape[axis - 1])
+                        {
+                            break;
+                        }
+                        in -= steps[axis - 1] * out_shape[axis - 1];
+                        counter[axis - 1] = 0;
+                    }
+                    if (axis == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -366,6 +366,101 @@ TEST(constant_folding, constant_broadcast_v1_numpy)
     ASSERT_EQ(values_expected, values_out);
 }
 
+// Broadcasts of rank above 6 and of multidimensional inputs go through the generic
+// stride-based kernel
+TEST(constant_folding, constant_broadcast_v1_numpy_rank7)
+{
+    vector<int32_t> values_in{0, 1, 2, 3, 4, 5};
+    auto constant_in = make_shared<op::Constant>(element::i32, Shape{2, 3}, values_in);
+    vector<int64_t> shape_in{2, 1, 2, 1, 2, 2, 3};
+    auto constant_shape = make_shared<op::Constant>(element::i64, Shape{7}, shape_in);
+    auto broadcast_v1 = make_shared<op::v1::Broadcast>(constant_in, constant_shape);
+    auto f = make_shared<Function>(broadcast_v1, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), (Shape{2, 1, 2, 1, 2, 2, 3}));
+    auto values_out = new_const->get_vector<int32_t>();
+
+    vector<int32_t> values_expected(values_out.size());
+    for (size_t i = 0; i < values_expected.size(); i++)
+    {
+        values_expected[i] = values_in[i % values_in.size()];
+    }
+    ASSERT_EQ(values_expected, values_out);
+}
+
+TEST(constant_folding, constant_broadcast_v1_numpy_rank7_unit_dim)
+{
+    vector<int32_t> values_in{7, 8, 9};
+    auto constant_in = make_shared<op::Constant>(element::i32, Shape{3, 1}, values_in);
+    vector<int64_t> shape_in{2, 1, 2, 1, 1, 3, 4};
+    auto constant_shape = make_shared<op::Constant>(element::i64, Shape{7}, shape_in);
+    auto broadcast_v1 = make_shared<op::v1::Broadcast>(constant_in, constant_shape);
+    auto f = make_shared<Function>(broadcast_v1, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<int32_t>();
+
+    // Every output row of 4 elements repeats one input value
+    vector<int32_t> values_expected(values_out.size());
+    for (size_t i = 0; i < values_expected.size(); i++)
+    {
+        values_expected[i] = values_in[(i / 4) % 3];
+    }
+    ASSERT_EQ(values_expected, values_out);
+}
+
+TEST(constant_folding, constant_broadcast_v1_explicit_rank7)
+{
+    vector<int32_t> values_in{0, 1, 2, 3, 4, 5};
+    auto constant_in = make_shared<op::Constant>(element::i32, Shape{2, 3}, values_in);
+    const Shape shape_out{2, 2, 1, 2, 1, 3, 2};
+    vector<int64_t> shape_in(shape_out.begin(), shape_out.end());
+    auto constant_shape = make_shared<op::Constant>(element::i64, Shape{7}, shape_in);
+    vector<int64_t> axes_in{1, 5};
+    auto constant_axes = make_shared<op::Constant>(element::i64, Shape{2}, axes_in);
+    auto broadcast_v1 = make_shared<op::v1::Broadcast>(constant_in, constant_shape, constant_axes);
+    auto f = make_shared<Function>(broadcast_v1, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<int32_t>();
+
+    // Output element [i0, i1, i2, i3, i4, i5, i6] is input element [i1, i5]
+    const auto strides_out = row_major_strides(shape_out);
+    vector<int32_t> values_expected(values_out.size());
+    for (size_t i = 0; i < values_expected.size(); i++)
+    {
+        const size_t i1 = i / strides_out[1] % shape_out[1];
+        const size_t i5 = i / strides_out[5] % shape_out[5];
+        values_expected[i] = values_in[i1 * 3 + i5];
+    }
+    ASSERT_EQ(values_expected, values_out);
+}
+
 TEST(constant_folding, constant_pad_exterior)
 {
     Shape shape_in{2};
@@ -1479,6 +1574,71 @@ TEST(constant_folding, const_concat)
     ASSERT_EQ(values_expected, values_out);
 }
 
+TEST(constant_folding, const_concat_middle_axis_of_gather_and_slice)
+{
+    auto data = op::Constant::create(
+        element::i32, Shape{2, 3, 2}, vector<int32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto indices = op::Constant::create(element::i64, Shape{2}, vector<int64_t>{-1, 0});
+    auto axis = op::Constant::create(element::i64, Shape{}, vector<int64_t>{1});
+    auto gather = make_shared<op::v1::Gather>(data, indices, axis);
+    auto slice =
+        make_shared<op::Slice>(data, Coordinate{0, 1, 1}, Coordinate{2, 3, 2}, Strides{1, 2, 1});
+    auto target_shape = op::Constant::create(element::i64, Shape{3}, vector<int64_t>{2, 1, 2});
+    auto broadcast = make_shared<op::v1::Broadcast>(slice, target_shape);
+    auto concat = make_shared<op::Concat>(NodeVector{gather, broadcast}, 1);
+    auto f = make_shared<Function>(concat, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), (Shape{2, 3, 2}));
+    auto values_out = new_const->get_vector<int32_t>();
+
+    vector<int32_t> values_expected{5, 6, 1, 2, 4, 4, 11, 12, 7, 8, 10, 10};
+
+    ASSERT_EQ(values_expected, values_out);
+}
+
+TEST(constant_folding, const_elementwise_chain)
+{
+    auto weights = op::Constant::create(element::f32, Shape{2, 2}, vector<float>{1, 2, 3, 4});
+    auto shift = op::Constant::create(element::f32, Shape{}, vector<float>{1});
+    auto scale = op::Constant::create(element::f32, Shape{2, 1}, vector<float>{2, -3});
+    auto subtract = make_shared<op::v1::Subtract>(weights, shift);
+    auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+    auto relu = make_shared<op::Relu>(multiply);
+    auto f = make_shared<Function>(relu, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<float>();
+
+    vector<float> values_expected{0, 2, 0, 0};
+    ASSERT_TRUE(test::all_close_f(values_expected, values_out, MIN_FLOAT_TOLERANCE_BITS));
+
+    // The whole chain is folded at once, outputs of intermediate ops are never replaced
+    // with constants
+    ASSERT_EQ(subtract->output(0).get_target_inputs().size(), 1);
+    ASSERT_EQ(subtract->output(0).get_target_inputs().begin()->get_node(), multiply.get());
+    ASSERT_EQ(multiply->output(0).get_target_inputs().size(), 1);
+    ASSERT_EQ(multiply->output(0).get_target_inputs().begin()->get_node(), relu.get());
+}
+
 TEST(constant_folding, const_not)
 {
     auto constant =
@@ -2149,6 +2309,24 @@ TEST(constant_folding, constant_dyn_reshape)
     ASSERT_TRUE(test::all_close_f(values_in, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, constant_dyn_reshape_shares_data)
+{
+    auto constant_in =
+        op::Constant::create(element::f32, Shape{2, 4}, vector<float>{0, 1, 2, 3, 4, 5, 6, 7});
+    auto constant_shape = op::Constant::create(element::i64, Shape{2}, vector<int64_t>{4, 2});
+    auto dyn_reshape = make_shared<op::v1::Reshape>(constant_in, constant_shape, false);
+    auto f = make_shared<Function>(dyn_reshape, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), (Shape{4, 2}));
+    ASSERT_EQ(new_const->get_data_ptr(), constant_in->get_data_ptr());
+}
+
 TEST(constant_folding, constant_dyn_reshape_shape_not_originally_constant)
 {
     Shape shape_in{2, 4};
@@ -191,6 +191,25 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({7, 10, 13, 16});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_missing_file)
+{
+    std::ifstream model_stream{
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt")};
+    // Without the model path data location can't be resolved
+    EXPECT_THROW(onnx_import::import_onnx_model(model_stream), ngraph_error);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(